@@ -2,21 +2,31 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <future>
+#include <iomanip>
 #include <iostream>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <set>
+#include <shared_mutex>
 #include <unordered_set>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -163,19 +173,32 @@ namespace avk
 #include <avk/descriptor_set.hpp>
 #include <avk/descriptor_set_layout.hpp>
 #include <avk/set_of_descriptor_set_layouts.hpp>
+#include <avk/layout_registry.hpp>
 #include <avk/descriptor_cache.hpp>
+#include <avk/descriptor_ring.hpp>
+#include <avk/bindless_table.hpp>
 
 #include <avk/commands.hpp>
 
 #include <avk/buffer.hpp>
+#include <avk/descriptor_buffer.hpp>
 #include <avk/shader_info.hpp>
+#include <avk/shader_archive_format.hpp>
+#include <avk/shader_archive.hpp>
 
 #include <avk/shader_binding_table.hpp>
 #include <avk/command_buffer.hpp>
 #include <avk/command_pool.hpp>
+#include <avk/command_pool_manager.hpp>
 
 #include <avk/semaphore.hpp>
 #include <avk/fence.hpp>
+#include <avk/fence_pool.hpp>
+#include <avk/completion_token.hpp>
+#include <avk/deletion_queue.hpp>
+#include <avk/completion_dispatcher.hpp>
+#include <avk/submission_service.hpp>
+#include <avk/submit_batch.hpp>
 
 #include <avk/sync.hpp>
 
@@ -208,13 +231,16 @@ namespace avk
 #include <avk/bottom_level_acceleration_structure.hpp>
 #include <avk/top_level_acceleration_structure.hpp>
 #include <avk/shader.hpp>
+#include <avk/pipeline_creation_feedback.hpp>
 
+#include <avk/graphics_pipeline_library_cache.hpp>
 #include <avk/graphics_pipeline_config.hpp>
 #include <avk/compute_pipeline_config.hpp>
 #include <avk/ray_tracing_pipeline_config.hpp>
 #include <avk/graphics_pipeline.hpp>
 #include <avk/compute_pipeline.hpp>
 #include <avk/ray_tracing_pipeline.hpp>
+#include <avk/pipeline_variants.hpp>
 
 #include <avk/query_pool.hpp>
 
@@ -264,6 +290,16 @@ namespace avk
 
 		bool is_format_supported(vk::Format pFormat, vk::ImageTiling pTiling, vk::FormatFeatureFlags aFormatFeatures);
 
+		/**	Record the device extensions which have been enabled for the given device. Call it right after the device has
+		 *	been created. Functionality which depends on optional extensions (like push descriptors) queries this record.
+		 *	For devices which have not been recorded, all optional extensions are considered to be disabled.
+		 */
+		static void record_enabled_device_extensions(vk::Device aDevice, const vk::DeviceCreateInfo& aDeviceCreateInfo);
+		/** Remove the record of the given device. Call it before the device is destroyed, s.t. its handle can be reused. */
+		static void forget_enabled_device_extensions(vk::Device aDevice);
+		/** True if the given extension has been recorded via record_enabled_device_extensions for the given device. */
+		static bool is_device_extension_enabled(vk::Device aDevice, std::string_view aExtensionName);
+
 #if VK_HEADER_VERSION >= 135
 		// Helper function used for creating both, bottom level and top level acceleration structures
 		template <typename T>
@@ -548,6 +584,10 @@ namespace avk
 
 #pragma region command pool and command buffer
 		command_pool create_command_pool(uint32_t aQueueFamilyIndex, vk::CommandPoolCreateFlags aCreateFlags = vk::CommandPoolCreateFlags());
+		/**	Create a manager which hands out one command pool per thread and queue family, see command_pool_manager.
+		 *	@param	aCreateFlags	The flags which all of its pools are created with
+		 */
+		command_pool_manager create_command_pool_manager(vk::CommandPoolCreateFlags aCreateFlags = vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
 #pragma endregion
 
 #pragma region compute pipeline
@@ -555,6 +595,11 @@ namespace avk
 		compute_pipeline create_compute_pipeline(compute_pipeline_config aConfig, std::function<void(compute_pipeline_t&)> aAlterConfigBeforeCreation = {});
 		compute_pipeline create_compute_pipeline_from_template(resource_reference<const compute_pipeline_t> aTemplate, std::function<void(compute_pipeline_t&)> aAlterConfigBeforeCreation = {});
 
+		/**	Create all variants of the given compute pipeline which result from the cross product of
+		 *	the given specialization constant axes. See create_graphics_pipeline_variants for details.
+		 */
+		pipeline_variants<compute_pipeline> create_compute_pipeline_variants(resource_reference<const compute_pipeline_t> aBasePipeline, std::vector<specialization_constant_axis> aAxes, uint32_t aMaxThreads = 0);
+
 		/**	Convenience function for gathering the compute pipeline's configuration.
 		 *
 		 *	It supports the following types
@@ -581,17 +626,56 @@ namespace avk
 #pragma endregion
 
 #pragma region descriptor pool
-		static descriptor_pool create_descriptor_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets);
-		descriptor_pool create_descriptor_pool(const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets);
+		static descriptor_pool create_descriptor_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets, vk::DescriptorPoolCreateFlags aFlags = {});
+		descriptor_pool create_descriptor_pool(const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets, vk::DescriptorPoolCreateFlags aFlags = {});
 		descriptor_cache create_descriptor_cache(std::string aName = "");
+		/**	Create an allocator for transient descriptor sets, which owns separate descriptor pools per frame in flight.
+		 *	@param	aFramesInFlight		Number of frames which can be in flight concurrently
+		 *	@param	aSetsPerPool		Number of sets which each of its pools can hold
+		 */
+		descriptor_ring create_descriptor_ring(uint32_t aFramesInFlight, uint32_t aSetsPerPool = 256, std::string aName = "");
+		/**	Create a bindless resource table, i.e., one update-after-bind descriptor set with arrays of sampled images,
+		 *	storage buffers, and samplers, which resources are registered into and referred to by index.
+		 *	@param	aSetId				The set-id which the table's set is bound to
+		 *	@param	aMaxImages			Size of the sampled images array
+		 *	@param	aMaxBuffers			Size of the storage buffers array
+		 *	@param	aMaxSamplers		Size of the samplers array
+		 *	@param	aFramesInFlight		Number of frames after which removed slots are reused
+		 *	@param	aShaderStages		The shader stages which access the table
+		 */
+		bindless_table create_bindless_table(uint32_t aSetId, uint32_t aMaxImages, uint32_t aMaxBuffers, uint32_t aMaxSamplers, uint32_t aFramesInFlight, shader_type aShaderStages = shader_type::all);
+#if VK_HEADER_VERSION >= 235
+		/**	Create a persistently mapped ring buffer which descriptors are written into directly (VK_EXT_descriptor_buffer).
+		 *	@param	aFramesInFlight			Number of frames which can be in flight concurrently; each one gets its own region
+		 *	@param	aBytesPerFrame			Size of each frame's region
+		 *	@param	aRobustBufferAccess		Must be true if the robustBufferAccess feature has been enabled
+		 */
+		descriptor_buffer create_descriptor_buffer(uint32_t aFramesInFlight, vk::DeviceSize aBytesPerFrame, bool aRobustBufferAccess = false);
+#endif
 #pragma endregion
 
 #pragma region descriptor set layout and set of descriptor set layouts
+		/**	The registry which deduplicates descriptor set layouts and pipeline layouts across all pipelines
+		 *	and descriptor caches. All descriptor set layouts and pipeline layouts are created through it.
+		 */
+		static layout_registry& global_layout_registry();
 		static void allocate_descriptor_set_layout(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, descriptor_set_layout& aLayoutToBeAllocated);
 		void allocate_descriptor_set_layout(descriptor_set_layout& aLayoutToBeAllocated);
+		/**	True if VK_KHR_push_descriptor has been enabled for the given device, see record_enabled_device_extensions.
+		 *	Sets marked via avk::push_descriptor are ordinary sets otherwise.
+		 */
+		static bool supports_push_descriptors(vk::Device aDevice);
+		/**	Create an update template for the given (allocated) layout, which writes all of its bindings from a
+		 *	descriptor_set's payload. Layouts with descriptor types which can not be written that way get none.
+		 */
+		static void allocate_descriptor_update_template(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, descriptor_set_layout& aLayout);
 		descriptor_set_layout create_descriptor_set_layout_from_template(const descriptor_set_layout& aTemplate);
 		void allocate_set_of_descriptor_set_layouts(set_of_descriptor_set_layouts& aLayoutsToBeAllocated);
 		set_of_descriptor_set_layouts create_set_of_descriptor_set_layouts_from_template(const set_of_descriptor_set_layouts& aTemplate);
+#if VK_HEADER_VERSION >= 235
+		/** Declare all (not yet allocated) layouts of the given set for use with descriptor buffers, see cfg::pipeline_settings::descriptor_buffer */
+		static void prepare_for_descriptor_buffers(set_of_descriptor_set_layouts& aLayouts);
+#endif
 #pragma endregion
 
 #pragma region fence
@@ -640,6 +724,34 @@ namespace avk
 		graphics_pipeline create_graphics_pipeline(graphics_pipeline_config aConfig, std::function<void(graphics_pipeline_t&)> aAlterConfigBeforeCreation = {});
 		graphics_pipeline create_graphics_pipeline_from_template(resource_reference<const graphics_pipeline_t> aTemplate, std::function<void(graphics_pipeline_t&)> aAlterConfigBeforeCreation = {});
 
+		/**	Create all variants of the given graphics pipeline which result from the cross product of
+		 *	the given specialization constant axes (e.g., quality levels x feature toggles).
+		 *	Every variant is created from the base pipeline as template, with the base pipeline's
+		 *	specialization constants overwritten by the values of the respective permutation.
+		 *	@param	aBasePipeline	The pipeline to derive all variants from
+		 *	@param	aAxes			The specialization constants to permute, see specialization_constant_values
+		 *	@param	aMaxThreads		Maximum number of threads to create the variants in parallel;
+		 *							0 means one per hardware thread. Pipelines which use a
+		 *							graphics_pipeline_library_cache are always created sequentially.
+		 *	@return	The variants, which can be looked up by their packed keys in O(1)
+		 */
+		pipeline_variants<graphics_pipeline> create_graphics_pipeline_variants(resource_reference<const graphics_pipeline_t> aBasePipeline, std::vector<specialization_constant_axis> aAxes, uint32_t aMaxThreads = 0);
+
+		/**	Set the specialization constants of one permutation for the given shader, which
+		 *	is part of a pipeline that is about to be created (i.e., before it is rewired).
+		 *	Only the axes which apply to the shader's type are considered.
+		 *	@param	aValueIndices	One index into each axis' values
+		 */
+		static void apply_specialization_constant_permutation(shader& aShader, const std::vector<specialization_constant_axis>& aAxes, const std::vector<size_t>& aValueIndices);
+#if VK_HEADER_VERSION >= 213
+		/**	Creates the given pipeline from the four graphics pipeline libraries (VK_EXT_graphics_pipeline_library),
+		 *	which are either taken from the given cache or created and added to it.
+		 *	This is invoked by rewire_config_and_create_graphics_pipeline for pipelines which have a library cache assigned.
+		 */
+		void create_graphics_pipeline_from_libraries(graphics_pipeline_t& aPreparedPipeline, graphics_pipeline_library_cache& aCache);
+		graphics_pipeline_library_cache create_graphics_pipeline_library_cache();
+#endif
+
 		/**	Convenience function for gathering the graphic pipeline's configuration.
 		 *
 		 *	It supports the following types:
@@ -663,6 +775,8 @@ namespace avk
 		 *   - cfg::tessellation_patch_control_points
 		 *   - cfg::per_sample_shading_config
 		 *   - cfg::stencil_test
+		 *   - cfg::dynamic_state (states which are to be set via command_buffer_t::set_* methods while recording)
+		 *   - cfg::pipeline_library_cache_usage (use cfg::use_pipeline_library_cache to fast-link the pipeline from cached pipeline libraries)
 		 *   - binding_data (data that is to be bound via descriptors)
 		 *   - push_constant_binding_data
 		 *   - std::function<void(graphics_pipeline_t&)> (a function to alter the pipeline config before it is created)
@@ -894,6 +1008,7 @@ namespace avk
 
 #pragma region shader
 		vk::UniqueHandle<vk::ShaderModule, DISPATCH_LOADER_CORE_TYPE> build_shader_module_from_binary_code(const std::vector<char>& aCode);
+		vk::UniqueHandle<vk::ShaderModule, DISPATCH_LOADER_CORE_TYPE> build_shader_module_from_binary_code(std::span<const uint32_t> aCode);
 		vk::UniqueHandle<vk::ShaderModule, DISPATCH_LOADER_CORE_TYPE> build_shader_module_from_file(const std::string& aPath);
 		shader create_shader(shader_info aInfo);
 		shader create_shader_from_template(const shader& aTemplate);
@@ -46,6 +46,12 @@ namespace avk
 			std::vector<const sampler_t*>,
 			std::vector<const image_sampler_t*>
 		> mResourcePtr;
+		/** Flags like eUpdateAfterBind or ePartiallyBound. They become part of the descriptor set layout (requires descriptor indexing if non-zero). */
+		vk::DescriptorBindingFlags mBindingFlags;
+		/** If true, the binding's set layout is created for push descriptors, see avk::push_descriptor and command_buffer_t::push_descriptors */
+		bool mPushDescriptor = false;
+		/** The result of compute_content_hash, precomputed by avk::descriptor_binding. 0 if it has not been computed. */
+		uint64_t mContentHash = 0;
 
 
 		template <typename T>
@@ -99,6 +105,17 @@ namespace avk
 		const void* next_pointer(descriptor_set& aDescriptorSet) const;
 
 		const vk::BufferView* texel_buffer_view_info(descriptor_set& aDescriptorSet) const;
+
+		/**	A 64-bit hash over the binding index, the descriptor type, and the descriptors' handles.
+		 *	The set-id is not part of it. Computing it does not allocate.
+		 */
+		uint64_t compute_content_hash() const;
+
+		/** Returns the precomputed mContentHash, or computes it if it has not been precomputed. */
+		uint64_t content_hash() const { return 0 != mContentHash ? mContentHash : compute_content_hash(); }
+
+		/** Returns true if the given write (as created by descriptor_set::prepare) writes exactly this binding's descriptors. Does not allocate. */
+		bool matches(const vk::WriteDescriptorSet& aWrite) const;
 	};
 
 	/** Compares two `binding_data` instances for equality, but only in
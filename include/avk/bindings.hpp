@@ -101,6 +101,8 @@ namespace avk
 				.setPImmutableSamplers(nullptr), // The pImmutableSamplers field is only relevant for image sampling related descriptors [3]
 			gather_one_or_multiple_element_pointers(aResource)
 		};
+		// Computed once here, s.t. descriptor cache lookups with this binding do not have to hash its descriptors again:
+		data.mContentHash = data.compute_content_hash();
 		return data;
 	}
 
@@ -120,6 +122,19 @@ namespace avk
 		return data;
 	}
 
+	/**	Mark the given binding's set as push descriptor set. Pass the result to a pipeline config s.t. the pipeline's
+	 *	layout declares that set with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR, and update the set
+	 *	via command_buffer_t::push_descriptors. If VK_KHR_push_descriptor is not enabled, the set is an ordinary
+	 *	one, and command_buffer_t::push_descriptors falls back to a descriptor_cache.
+	 *	Example usage:
+	 *	  avk::push_descriptor(avk::descriptor_binding(0, 0, myUniformBuffer))
+	 */
+	inline binding_data push_descriptor(binding_data aBinding)
+	{
+		aBinding.mPushDescriptor = true;
+		return aBinding;
+	}
+
 	template <typename T>
 	typename std::enable_if<avk::has_size_and_iterators<T>::value, std::vector<buffer_descriptor>>::type as_uniform_buffers(const T& aCollection)
 	{
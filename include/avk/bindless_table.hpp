@@ -0,0 +1,123 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	A bindless resource table: One descriptor set with large arrays of sampled images, storage buffers,
+	 *	and samplers, into which resources are registered once and then referred to by stable uint32_t
+	 *	indices, e.g., from per-material or per-draw data. All materials can thereby be drawn with the same
+	 *	pipeline layout and the same bound set, without any per-draw descriptor work.
+	 *
+	 *	The arrays are declared with eUpdateAfterBind, ePartiallyBound, and eUpdateUnusedWhilePending, i.e.,
+	 *	resources can be added while the set is bound in command buffers which are in flight, and slots
+	 *	which have never been written are fine as long as shaders do not access them.
+	 *	Requirements: The descriptor indexing features descriptorBindingPartiallyBound,
+	 *	descriptorBindingUpdateUnusedWhilePending, descriptorBinding{SampledImage,StorageBuffer}UpdateAfterBind,
+	 *	and runtimeDescriptorArray (for the shader side) must be enabled.
+	 *
+	 *	Removed slots are not reused immediately, but only after all frames in flight which might still
+	 *	access them have completed, see begin_frame. The removed resources must be kept alive until then, too.
+	 *	All functions which add or remove resources are thread-safe.
+	 *	Create instances via root::create_bindless_table.
+	 */
+	class bindless_table
+	{
+		friend class root;
+
+	public:
+		bindless_table() = default;
+		bindless_table(bindless_table&&) noexcept = default;
+		bindless_table(const bindless_table&) = delete;
+		bindless_table& operator=(bindless_table&&) noexcept = default;
+		bindless_table& operator=(const bindless_table&) = delete;
+		~bindless_table() = default;
+
+		auto set_id() const { return mSetId; }
+		auto frames_in_flight() const { return mFramesInFlight; }
+		auto max_images() const { return mImageSlots.mCapacity; }
+		auto max_buffers() const { return mBufferSlots.mCapacity; }
+		auto max_samplers() const { return mSamplerSlots.mCapacity; }
+		const auto& layout() const { return mLayout; }
+
+		/** The table's descriptor set, to be bound via command_buffer_t::bind_descriptors. It is the same set for the whole lifetime of the table. */
+		const avk::descriptor_set& get_descriptor_set() const { return mDescriptorSet; }
+
+		/**	The bindings of the table, to be passed to pipeline configurations s.t. the pipelines' layouts are
+		 *	compatible with the table's set. In GLSL, declare the arrays unsized, e.g.:
+		 *	  layout(set = 1, binding = 0) uniform texture2D uTextures[];
+		 *	  layout(set = 1, binding = 1) buffer Buffers { uint data[]; } uBuffers[];
+		 *	  layout(set = 1, binding = 2) uniform sampler uSamplers[];
+		 */
+		binding_data image_binding() const { return binding_data{ mSetId, mLayout.binding_at(image_binding_id), {}, mLayout.binding_flags_at(image_binding_id) }; }
+		binding_data buffer_binding() const { return binding_data{ mSetId, mLayout.binding_at(buffer_binding_id), {}, mLayout.binding_flags_at(buffer_binding_id) }; }
+		binding_data sampler_binding() const { return binding_data{ mSetId, mLayout.binding_at(sampler_binding_id), {}, mLayout.binding_flags_at(sampler_binding_id) }; }
+
+		/**	Write the given image view into a free slot of the sampled images array.
+		 *	@return	The slot's index, which stays valid until it is passed to remove_image
+		 */
+		uint32_t add(const image_view_t& aImageView);
+		/**	Write the given buffer into a free slot of the storage buffers array.
+		 *	@return	The slot's index, which stays valid until it is passed to remove_buffer
+		 */
+		uint32_t add(const buffer_t& aBuffer);
+		/**	Write the given sampler into a free slot of the samplers array.
+		 *	@return	The slot's index, which stays valid until it is passed to remove_sampler
+		 */
+		uint32_t add(const sampler_t& aSampler);
+
+		/**	Release the given slot. It is reused once all frames in flight which might still access it have completed.
+		 *	Throws if the slot is not in use, e.g., because it has already been released.
+		 */
+		void remove_image(uint32_t aIndex);
+		/**	Release the given slot. It is reused once all frames in flight which might still access it have completed.
+		 *	Throws if the slot is not in use, e.g., because it has already been released.
+		 */
+		void remove_buffer(uint32_t aIndex);
+		/**	Release the given slot. It is reused once all frames in flight which might still access it have completed.
+		 *	Throws if the slot is not in use, e.g., because it has already been released.
+		 */
+		void remove_sampler(uint32_t aIndex);
+
+		/**	Mark the beginning of a new frame. Slots which have been removed during frame aFrameId - frames_in_flight()
+		 *	or earlier become available again. Call it after the fence of that earlier frame has been signaled.
+		 *	@param	aFrameId	Monotonically increasing frame number
+		 */
+		void begin_frame(uint64_t aFrameId);
+
+		static constexpr uint32_t image_binding_id = 0u;
+		static constexpr uint32_t buffer_binding_id = 1u;
+		static constexpr uint32_t sampler_binding_id = 2u;
+
+	private:
+		// Hands out slot indices of one array, and recycles released ones with a delay of frames in flight:
+		struct slot_allocator
+		{
+			uint32_t allocate();
+			void release(uint32_t aIndex, uint64_t aFrameId);
+			void recycle_released_until(uint64_t aLastCompletedFrame);
+
+			uint32_t mCapacity = 0u;
+			// Slots below this one have been handed out at least once:
+			uint32_t mNextUnused = 0u;
+			std::vector<uint32_t> mFree;
+			// For each slot below mNextUnused: true while it is handed out, i.e., between allocate and release:
+			std::vector<bool> mInUse;
+			// Released slots and the frames during which they have been released, in ascending frame order:
+			std::deque<std::tuple<uint64_t, uint32_t>> mReleased;
+		};
+
+		void write(uint32_t aBinding, uint32_t aIndex, const vk::DescriptorImageInfo* aImageInfo, const vk::DescriptorBufferInfo* aBufferInfo);
+
+		const root* mRoot;
+		uint32_t mSetId;
+		uint32_t mFramesInFlight;
+		descriptor_set_layout mLayout;
+		avk::descriptor_set mDescriptorSet;
+		slot_allocator mImageSlots;
+		slot_allocator mBufferSlots;
+		slot_allocator mSamplerSlots;
+		uint64_t mCurrentFrame = 0;
+		// Guards the slot allocators and the writes. Held via unique_ptr to keep the table movable:
+		std::unique_ptr<std::mutex> mMutex;
+	};
+}
@@ -18,11 +18,13 @@ namespace avk
 		auto descriptor_type() const { return mDescriptorType; }
 		const auto& descriptor_info() const { return mDescriptorInfo; }
 		const auto& view_handle() const { return mBufferViewHandle; }
+		auto format() const { return mFormat; }
 		
 	private:
 		vk::DescriptorType mDescriptorType;
 		vk::DescriptorBufferInfo mDescriptorInfo;
 		vk::BufferView mBufferViewHandle;
+		vk::Format mFormat;
 	};
 	
 	/** Class representing a buffer view, which "wraps" a uniform texel buffer or a storage texel buffer */
@@ -83,6 +85,7 @@ namespace avk
 				result.mDescriptorInfo = std::get<buffer>(mBuffer)->descriptor_info();
 				result.mDescriptorType = std::get<buffer>(mBuffer)->meta<Meta>().descriptor_type().value();
 				result.mBufferViewHandle = view_handle();
+				result.mFormat = mCreateInfo.format;
 				return result;
 			}
 			throw avk::runtime_error("Which descriptor type?");
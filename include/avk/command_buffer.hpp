@@ -14,6 +14,9 @@ namespace avk
 	class set_of_descriptor_set_layouts;
 	class framebuffer_t;
 	struct binding_data;
+	struct command_buffer_free_list;
+	struct completion_token;
+	class completion_dispatcher;
 
 	enum struct command_buffer_state
 	{
@@ -53,6 +56,8 @@ namespace avk
 		friend class root;
 		friend class queue;
 		friend class command_pool_t;
+		friend class submission_service;
+		friend class submit_batch;
 		
 	public:
 		command_buffer_t() = default;
@@ -64,24 +69,12 @@ namespace avk
 
 		/** Set a custom deleter function.
 		 *	This is often used for resource cleanup, e.g. a buffer which can be deleted when this command buffer is destroyed.
+		 *	Multiple custom deleters are invoked in inverse order of addition. See also deletion_queue.
 		 */
 		template <typename F>
 		command_buffer_t& set_custom_deleter(F&& aDeleter) noexcept
 		{
-			if (mCustomDeleter.has_value()) {
-				// There is already a custom deleter! Make sure that this stays alive as well.
-				mCustomDeleter = [
-					existingDeleter = std::move(mCustomDeleter.value()),
-					additionalDeleter = std::forward<F>(aDeleter)
-				]() {
-					// Invoke in inverse order of addition:
-					additionalDeleter();
-					existingDeleter();
-				};
-			}
-			else {
-				mCustomDeleter = std::forward<F>(aDeleter);
-			}
+			mCustomDeleters.emplace_back(std::forward<F>(aDeleter));
 			return *this;
 		}
 
@@ -111,10 +104,42 @@ namespace avk
 
 		void invoke_post_execution_handler() const;
 
+		/** Set a completion handler function, which is invoked once the GPU has completed executing this command buffer,
+		 *	e.g., to read back results without blocking. Unlike post-execution handlers, which run at submission time,
+		 *	completion handlers are handed over to the completion_dispatcher which is passed to
+		 *	queue::submit_with_completion_token. Handlers which have not been handed over are invoked when this
+		 *	command buffer is reset or destroyed, which also requires it to have completed.
+		 *	Multiple completion handlers are invoked in order of addition.
+		 */
+		template <typename F>
+		command_buffer_t& set_completion_handler(F&& aHandler) noexcept
+		{
+			mCompletionHandlers.emplace_back(std::forward<F>(aHandler));
+			return *this;
+		}
+
 		void begin_recording();
+		/**	Begin recording a secondary command buffer which inherits the given state. If a render pass is
+		 *	set in aInheritanceInfo, the command buffer continues that render pass' subpass, i.e., it is
+		 *	begun with eRenderPassContinue. See inheritance_info_for_current_subpass.
+		 */
+		void begin_recording(const vk::CommandBufferInheritanceInfo& aInheritanceInfo);
 		void end_recording();
 		void begin_render_pass_for_framebuffer(resource_reference<const renderpass_t> aRenderpass, resource_reference<framebuffer_t> aFramebuffer, vk::Offset2D aRenderAreaOffset = {0, 0}, std::optional<vk::Extent2D> aRenderAreaExtent = {}, bool aSubpassesInline = true);
 		void next_subpass();
+
+		/**	Get the inheritance info for secondary command buffers which are to be executed in the current
+		 *	subpass of this primary command buffer. The render pass must have been begun with aSubpassesInline = false.
+		 */
+		vk::CommandBufferInheritanceInfo inheritance_info_for_current_subpass() const;
+
+		/**	Execute the given secondary command buffers in the given order via vkCmdExecuteCommands.
+		 *	They are kept alive until this command buffer is destroyed or prepared for reuse, and their
+		 *	post-execution handlers are invoked with this command buffer's.
+		 *	Bound descriptor sets and dynamic states are undefined afterwards, therefore their tracking is reset.
+		 *	See command_pool_manager::record_secondaries_in_parallel for recording them on multiple threads.
+		 */
+		void execute_commands(std::vector<command_buffer> aSecondaryCommandBuffers);
 		void establish_execution_barrier(pipeline_stage aSrcStage, pipeline_stage aDstStage);
 		void establish_global_memory_barrier(pipeline_stage aSrcStage, pipeline_stage aDstStage, std::optional<memory_access> aSrcAccessToBeMadeAvailable, std::optional<memory_access> aDstAccessToBeMadeVisible);
 		void establish_global_memory_barrier_rw(pipeline_stage aSrcStage, pipeline_stage aDstStage, std::optional<write_memory_access> aSrcAccessToBeMadeAvailable, std::optional<read_memory_access> aDstAccessToBeMadeVisible);
@@ -404,6 +429,7 @@ namespace avk
 		const vk::CommandBuffer& handle() const { return mCommandBuffer.get(); }
 		const vk::CommandBuffer* handle_ptr() const { return &mCommandBuffer.get(); }
 		auto state() const { return mState; }
+		auto level() const { return mLevel; }
 
 		// Template specializations are implemented in the respective pipeline's header files
 		template <typename T> // Expected to be just the pipeline's type
@@ -419,6 +445,60 @@ namespace avk
 
 		void bind_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, std::vector<descriptor_set> aDescriptorSets);
 
+		/**	Bind descriptor sets via a shared pipeline layout (see layout_registry).
+		 *	The bound sets are tracked per bind point, and sets which are still bound via a compatible
+		 *	layout are not bound again. Tracked sets are discarded when recording begins. If descriptor
+		 *	sets are bound via handle() directly, call reset_descriptor_set_tracking afterwards.
+		 */
+		void bind_descriptors(vk::PipelineBindPoint aBindingPoint, const std::shared_ptr<const shared_pipeline_layout>& aLayout, std::vector<descriptor_set> aDescriptorSets);
+
+		/** Forget all tracked descriptor set bindings, s.t. the next bind_descriptors call binds all of its sets. */
+		void reset_descriptor_set_tracking()
+		{
+			mBoundDescriptorSets = {};
+#if VK_HEADER_VERSION >= 235
+			mBoundDescriptorBuffer = vk::Buffer{};
+#endif
+		}
+
+		/**	Update the given bindings' sets via vkCmdPushDescriptorSetKHR, without any descriptor set allocation or caching.
+		 *	Only sets which have been declared via avk::push_descriptor in the pipeline's config are pushed. The bindings
+		 *	of all other sets (e.g., all of them if VK_KHR_push_descriptor is not enabled) are taken from aFallbackCache
+		 *	and bound via bind_descriptors.
+		 *	Single resources are pushed without any heap allocations; arrays of resources have to be gathered first.
+		 *	@param	aBindings		Bindings as created via avk::descriptor_binding
+		 *	@param	aFallbackCache	Provides the sets which can not be pushed
+		 *	@param	aRoot			Used for dispatching the commands via dispatch_loader_ext.
+		 */
+		void push_descriptors(vk::PipelineBindPoint aBindingPoint, const std::shared_ptr<const shared_pipeline_layout>& aLayout, std::initializer_list<binding_data> aBindings, descriptor_cache& aFallbackCache, const root& aRoot);
+
+		// Template specializations are implemented in the respective pipeline's header files
+		template <typename T>
+		void push_descriptors(T aPipelineLayoutTuple, std::initializer_list<binding_data> aBindings, descriptor_cache& aFallbackCache, const root& aRoot)
+		{
+			assert(false);
+			throw avk::logic_error("No suitable push_descriptors overload found for the given pipeline/layout.");
+		}
+
+#if VK_HEADER_VERSION >= 235
+		/**	Write the given bindings into aDescriptorBuffer's current frame region and bind them via
+		 *	vkCmdSetDescriptorBufferOffsetsEXT, i.e., without any descriptor sets, pools, or vkUpdateDescriptorSets.
+		 *	The pipeline must have been created with cfg::pipeline_settings::descriptor_buffer. The descriptor
+		 *	buffer itself is only bound once, until a different one is used or recording begins anew.
+		 *	@param	aBindings			Bindings as created via avk::descriptor_binding
+		 *	@param	aDescriptorBuffer	Receives the descriptors; see descriptor_buffer::begin_frame for their lifetime
+		 */
+		void bind_descriptors(vk::PipelineBindPoint aBindingPoint, const std::shared_ptr<const shared_pipeline_layout>& aLayout, std::initializer_list<binding_data> aBindings, descriptor_buffer& aDescriptorBuffer);
+
+		// Template specializations are implemented in the respective pipeline's header files
+		template <typename T>
+		void bind_descriptors(T aPipelineLayoutTuple, std::initializer_list<binding_data> aBindings, descriptor_buffer& aDescriptorBuffer)
+		{
+			assert(false);
+			throw avk::logic_error("No suitable bind_descriptors overload found for the given pipeline/layout.");
+		}
+#endif
+
 		// Template specializations are implemented in the respective pipeline's header files
 		template <typename T> 
 		void bind_descriptors(T aPipelineLayoutTuple, std::vector<descriptor_set> aDescriptorSets)
@@ -450,6 +530,37 @@ namespace avk
 			AVK_LOG_WARNING("No vk::PushConstantRange entry found that matches the dataSize[" + std::to_string(dataSize) + "]");
 		}
 
+#if VK_HEADER_VERSION >= 204
+		/**	Set states which have been declared dynamic via cfg::dynamic_state in the bound graphics pipeline's config.
+		 *	The last value of each state is tracked, and a setter which would not change it does not record anything.
+		 *	Tracked values are discarded when recording begins and when a graphics pipeline is bound which
+		 *	does not declare the respective state dynamic. If commands are recorded into handle() directly,
+		 *	which change any of these states, call reset_dynamic_state_tracking afterwards.
+		 *	@param	aRoot	Used for dispatching the commands via dispatch_loader_ext.
+		 */
+		void set_cull_mode(vk::CullModeFlags aCullMode, const root& aRoot);
+		void set_front_face(vk::FrontFace aFrontFace, const root& aRoot);
+		void set_primitive_topology(vk::PrimitiveTopology aPrimitiveTopology, const root& aRoot);
+		void set_depth_test_enable(bool aEnable, const root& aRoot);
+		void set_depth_write_enable(bool aEnable, const root& aRoot);
+		void set_depth_compare_operation(vk::CompareOp aCompareOp, const root& aRoot);
+		void set_depth_bounds_test_enable(bool aEnable, const root& aRoot);
+		void set_stencil_test_enable(bool aEnable, const root& aRoot);
+		void set_stencil_operation(vk::StencilFaceFlags aFaceMask, vk::StencilOp aFailOp, vk::StencilOp aPassOp, vk::StencilOp aDepthFailOp, vk::CompareOp aCompareOp, const root& aRoot);
+		void set_rasterizer_discard_enable(bool aEnable, const root& aRoot);
+		void set_depth_bias_enable(bool aEnable, const root& aRoot);
+		void set_primitive_restart_enable(bool aEnable, const root& aRoot);
+#if VK_HEADER_VERSION >= 233
+		void set_polygon_mode(vk::PolygonMode aPolygonMode, const root& aRoot);
+		void set_depth_clamp_enable(bool aEnable, const root& aRoot);
+		void set_color_blend_enable(uint32_t aAttachment, bool aEnable, const root& aRoot);
+		void set_color_write_mask(uint32_t aAttachment, vk::ColorComponentFlags aColorWriteMask, const root& aRoot);
+#endif
+
+		/** Forget all tracked dynamic state values, s.t. the next set_* call for each state records a command. */
+		void reset_dynamic_state_tracking() { mDynamicStateValues = {}; }
+#endif
+
 #if VK_HEADER_VERSION >= 135
 		/**	Issue a trace rays call.
 		 *	@param	aRaygenDimensions			Dimensions of the trace rays call. This can be the extent of a window's backbuffer
@@ -595,17 +706,82 @@ namespace avk
 #endif
 		
 	private:
-		command_buffer_state mState;
+		/** Descriptor sets which have been bound for one pipeline bind point, and the layout they have been bound with */
+		struct bound_descriptor_sets
+		{
+			std::shared_ptr<const shared_pipeline_layout> mLayout;
+			// Indexed by set id, null handles for sets which are not bound:
+			std::vector<vk::DescriptorSet> mSets;
+		};
+		// Graphics, compute, and ray tracing:
+		std::array<bound_descriptor_sets, 3> mBoundDescriptorSets;
+#if VK_HEADER_VERSION >= 235
+		// The descriptor buffer which has been bound via bind_descriptors, if any:
+		vk::Buffer mBoundDescriptorBuffer;
+#endif
+
+		void issue_bind_descriptor_sets(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, const std::vector<descriptor_set>& aDescriptorSets);
+		/** Get the tracked sets of the given bind point, after discarding those which are not compatible with aLayout */
+		bound_descriptor_sets& bound_descriptor_sets_for(vk::PipelineBindPoint aBindingPoint, const std::shared_ptr<const shared_pipeline_layout>& aLayout);
+
+#if VK_HEADER_VERSION >= 204
+		/** Discard the tracked values of all dynamic states which are not contained in the given list */
+		void invalidate_dynamic_states_not_in(const std::vector<vk::DynamicState>& aDynamicStates);
+
+		/** Last values set via the set_* methods for dynamic states, used to filter out redundant state changes */
+		struct dynamic_state_values
+		{
+			std::optional<vk::CullModeFlags> mCullMode;
+			std::optional<vk::FrontFace> mFrontFace;
+			std::optional<vk::PrimitiveTopology> mPrimitiveTopology;
+			std::optional<bool> mDepthTestEnable;
+			std::optional<bool> mDepthWriteEnable;
+			std::optional<vk::CompareOp> mDepthCompareOp;
+			std::optional<bool> mDepthBoundsTestEnable;
+			std::optional<bool> mStencilTestEnable;
+			// [0] = front faces, [1] = back faces; each containing: fail op, pass op, depth fail op, compare op
+			std::array<std::optional<std::tuple<vk::StencilOp, vk::StencilOp, vk::StencilOp, vk::CompareOp>>, 2> mStencilOp;
+			std::optional<bool> mRasterizerDiscardEnable;
+			std::optional<bool> mDepthBiasEnable;
+			std::optional<bool> mPrimitiveRestartEnable;
+#if VK_HEADER_VERSION >= 233
+			std::optional<vk::PolygonMode> mPolygonMode;
+			std::optional<bool> mDepthClampEnable;
+			std::vector<std::optional<bool>> mColorBlendEnable;
+			std::vector<std::optional<vk::ColorComponentFlags>> mColorWriteMask;
+#endif
+		};
+		dynamic_state_values mDynamicStateValues;
+#endif
+
+		command_buffer_state mState = command_buffer_state::none;
+		vk::CommandBufferLevel mLevel = vk::CommandBufferLevel::ePrimary;
 		vk::CommandBufferBeginInfo mBeginInfo;
+		// Pointed to by mBeginInfo while recording is begun; required for secondary command buffers:
+		std::optional<vk::CommandBufferInheritanceInfo> mInheritanceInfo;
 		vk::UniqueHandle<vk::CommandBuffer, DISPATCH_LOADER_CORE_TYPE> mCommandBuffer;
 		vk::SubpassContents mSubpassContentsState;
+		// The render pass instance which is currently being recorded, if any:
+		vk::RenderPass mCurrentRenderPass;
+		vk::Framebuffer mCurrentFramebuffer;
+		uint32_t mCurrentSubpass = 0u;
 		
-		/** A custom deleter function called upon destruction of this command buffer */
-		std::optional<avk::unique_function<void()>> mCustomDeleter;
+		/** Custom deleter functions called upon destruction of this command buffer */
+		std::vector<avk::unique_function<void()>> mCustomDeleters;
 
 		std::optional<avk::unique_function<void()>> mPostExecutionHandler;
 
+#if VK_HEADER_VERSION >= 135
+		// Register the completion handlers with the dispatcher, to be invoked once the token has completed:
+		void hand_over_completion_handlers(completion_dispatcher& aCompletionDispatcher, const completion_token& aToken);
+#endif
+
+		/** Completion handlers, which have not been handed over to a completion_dispatcher (yet) */
+		std::vector<avk::unique_function<void()>> mCompletionHandlers;
+
 		std::shared_ptr<vk::UniqueHandle<vk::CommandPool, DISPATCH_LOADER_CORE_TYPE>> mCommandPool;
+		// The pool's free list, into which the handle is returned upon destruction instead of being freed:
+		std::shared_ptr<command_buffer_free_list> mFreeList;
 	};
 
 	// Typedef for a variable representing an owner of a command_buffer
@@ -3,6 +3,19 @@
 
 namespace avk
 {
+	/**	Command buffer handles which have been returned to their pool for reuse, see command_pool_t.
+	 *	Shared between a pool and all command buffers allocated from it, s.t. command buffers can
+	 *	return their handles upon destruction, regardless of whether the command_pool_t instance still exists.
+	 */
+	struct command_buffer_free_list
+	{
+		std::mutex mMutex;
+		// Indexed by level (0 = primary, 1 = secondary). Handles in the initial state, i.e., never
+		// recorded, or their pool has been reset after they have been returned:
+		std::array<std::vector<vk::CommandBuffer>, 2> mInitial;
+		// Handles which have been recorded and must be reset before they can be recorded again:
+		std::array<std::vector<vk::CommandBuffer>, 2> mRecorded;
+	};
 
 	/** Represents a Vulkan command pool, holds the native handle and takes
 	*	care about lifetime management of the native handles.
@@ -12,6 +25,14 @@ namespace avk
 	*	 on queues from the same queue family." [+]
 	*	
 	*	[+]: https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkCommandPoolCreateInfo.html
+	*
+	*	Command buffers are recycled: When a command_buffer_t is destroyed, its handle is not freed but
+	*	returned to the pool's free list, and alloc_command_buffers hands out recycled handles before it
+	*	allocates new ones. Recorded handles are reset individually if the pool has been created with
+	*	eResetCommandBuffer; otherwise, they are freed upon the next allocation. Cheaper than both, call
+	*	reset() once per frame, which resets all of them at once.
+	*	A command buffer must only be destroyed after it has completed execution, which is the same
+	*	requirement as for freeing it.
 	*/
 	class command_pool_t
 	{
@@ -34,12 +55,23 @@ namespace avk
 		std::vector<command_buffer> alloc_command_buffers(uint32_t aCount, vk::CommandBufferUsageFlags aUsageFlags = {}, vk::CommandBufferLevel aLevel = vk::CommandBufferLevel::ePrimary);
 			
 		command_buffer alloc_command_buffer(vk::CommandBufferUsageFlags aUsageFlags = {}, vk::CommandBufferLevel aLevel = vk::CommandBufferLevel::ePrimary);
+
+		/**	Reset the whole pool via vkResetCommandPool. All command buffers which have been returned to
+		 *	the pool become available for reuse without being reset individually.
+		 *	Attention: All command buffers allocated from this pool are reset, also the ones which are still
+		 *	alive. None of them must be pending execution, e.g., call it after the frame's fence has been signaled.
+		 */
+		void reset(vk::CommandPoolResetFlags aFlags = {});
+
+		/** Number of command buffer handles which have been returned to this pool and await their reuse */
+		size_t number_of_recycled_command_buffers() const;
 		
 	private:
 		uint32_t mQueueFamilyIndex;
 		const root* mRoot;
 		vk::CommandPoolCreateInfo mCreateInfo;
 		std::shared_ptr<vk::UniqueHandle<vk::CommandPool, DISPATCH_LOADER_CORE_TYPE>> mCommandPool;
+		std::shared_ptr<command_buffer_free_list> mFreeList;
 	};
 
 	using command_pool = owning_resource<command_pool_t>;
@@ -0,0 +1,106 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Hands out one command pool per thread and queue family. Pools are created lazily, on the first
+	 *	request of a thread for a queue family.
+	 *
+	 *	Vulkan command pools are externally synchronized, i.e., one pool must not be used from multiple
+	 *	threads concurrently. By letting each thread allocate from its own pools, command buffers can be
+	 *	allocated and recorded on worker threads without any locking around the pools. Only the lookup
+	 *	of the calling thread's pool is guarded by a mutex.
+	 *
+	 *	Destroying a command buffer does not access its pool; its handle is only returned to the pool's
+	 *	free list (see command_pool_t). Command buffers can therefore be destroyed on any thread.
+	 *
+	 *	avk::sync allocates its implicit command buffers via sync::sCommandPoolManager.
+	 *	Create instances via root::create_command_pool_manager.
+	 */
+	class command_pool_manager
+	{
+		friend class root;
+
+	public:
+		command_pool_manager() = default;
+		command_pool_manager(command_pool_manager&&) noexcept = default;
+		command_pool_manager(const command_pool_manager&) = delete;
+		command_pool_manager& operator=(command_pool_manager&&) noexcept = default;
+		command_pool_manager& operator=(const command_pool_manager&) = delete;
+		~command_pool_manager() = default;
+
+		/** The flags which all pools are created with */
+		auto create_flags() const { return mCreateFlags; }
+
+		/** Get the calling thread's pool for the given queue family, creating it if it does not exist yet. */
+		command_pool_t& pool_for_this_thread(uint32_t aQueueFamilyIndex);
+
+		/** Allocate command buffers from the calling thread's pool for the given queue family. */
+		std::vector<command_buffer> alloc_command_buffers(uint32_t aQueueFamilyIndex, uint32_t aCount, vk::CommandBufferUsageFlags aUsageFlags = {}, vk::CommandBufferLevel aLevel = vk::CommandBufferLevel::ePrimary);
+
+		/** Allocate a command buffer from the calling thread's pool for the given queue family. */
+		command_buffer alloc_command_buffer(uint32_t aQueueFamilyIndex, vk::CommandBufferUsageFlags aUsageFlags = {}, vk::CommandBufferLevel aLevel = vk::CommandBufferLevel::ePrimary);
+
+		/**	Reset all pools of the calling thread via command_pool_t::reset, e.g., once per frame after the
+		 *	frame's fence has been signaled. None of their command buffers must be pending execution.
+		 */
+		void reset_pools_of_this_thread(vk::CommandPoolResetFlags aFlags = {});
+
+		/**	Record secondary command buffers on multiple threads, e.g., the draw calls of one subpass, split
+		 *	into chunks. Every chunk is recorded into its own secondary command buffer. The calling thread
+		 *	takes part in the recording; the other chunks are recorded by worker threads, which are started on
+		 *	first use and kept alive for subsequent calls. Each worker allocates from pools reserved for it.
+		 *	Concurrent invocations are serialized.
+		 *	@param	aQueueFamilyIndex	The queue family which the primary command buffer is going to be submitted to
+		 *	@param	aInheritanceInfo	Typically the primary's command_buffer_t::inheritance_info_for_current_subpass()
+		 *	@param	aNumberOfChunks		Number of secondary command buffers to record
+		 *	@param	aRecordChunk		Invoked as aRecordChunk(aSecondaryCommandBuffer, aChunkIndex) concurrently for
+		 *								different chunks, with the command buffer in recording state already.
+		 *	@param	aMaxThreads			Maximum number of threads to record on; 0 means one per hardware thread.
+		 *	@return	The secondary command buffers ordered by chunk index, to be passed to command_buffer_t::execute_commands
+		 */
+		std::vector<command_buffer> record_secondaries_in_parallel(uint32_t aQueueFamilyIndex, const vk::CommandBufferInheritanceInfo& aInheritanceInfo, uint32_t aNumberOfChunks, const std::function<void(command_buffer_t&, uint32_t)>& aRecordChunk, uint32_t aMaxThreads = 0);
+
+		/** Number of pools which have been created for all threads and queue families */
+		size_t number_of_pools() const;
+
+		/**	Release the pools of the given thread, e.g., when a worker thread terminates. Command buffers which
+		 *	have been allocated from them keep their pools alive until they are destroyed.
+		 */
+		void release_pools_of_thread(std::thread::id aThreadId);
+
+	private:
+		// Persistent worker threads of record_secondaries_in_parallel. Worker i (with i >= 1) records with the pools of
+		// mParallelRecordingPools at worker index i; worker 0 is the calling thread.
+		struct recording_workers
+		{
+			~recording_workers();
+			// Run aJob(i) on workers 1 to aNumberOfWorkers-1, and return once all of them have completed it:
+			void start(const std::function<void(uint32_t)>& aJob, uint32_t aNumberOfWorkers);
+			void wait();
+			void worker_loop(uint32_t aWorkerIndex, uint64_t aLastSeenJob);
+
+			std::mutex mMutex;
+			std::condition_variable mJobPosted;
+			std::condition_variable mJobDone;
+			std::vector<std::thread> mThreads;
+			const std::function<void(uint32_t)>* mJob = nullptr;
+			uint32_t mNumberOfWorkers = 0;
+			uint32_t mNumberOfBusyWorkers = 0;
+			uint64_t mJobId = 0;
+			bool mStop = false;
+		};
+
+		root* mRoot = nullptr;
+		vk::CommandPoolCreateFlags mCreateFlags;
+		// Held via unique_ptr to keep the manager movable:
+		std::unique_ptr<std::mutex> mMutex;
+		std::map<std::tuple<std::thread::id, uint32_t>, command_pool> mPools;
+		// Serializes record_secondaries_in_parallel, which uses one of these pools per worker and queue family:
+		std::unique_ptr<std::mutex> mParallelRecordingMutex;
+		std::map<std::tuple<uint32_t, uint32_t>, command_pool> mParallelRecordingPools;
+		// Declared after the pools, s.t. the threads are joined before the pools are destroyed. Held via unique_ptr,
+		// s.t. the threads' pointer to it stays valid when the manager is moved:
+		std::unique_ptr<recording_workers> mRecordingWorkers;
+	};
+}
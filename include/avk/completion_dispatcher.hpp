@@ -0,0 +1,83 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Invokes callbacks once the GPU has completed the work they have been registered for, i.e., once a
+	 *	fence has been signaled or a completion_token has completed. This enables non-blocking readbacks
+	 *	and recycling of resources. Callbacks are invoked in the order of their registration, except
+	 *	that callbacks whose work has completed earlier do not wait for ones whose work is still pending.
+	 *
+	 *	Completion is detected either by poll(), which checks all pending work and invokes the callbacks on
+	 *	the calling thread, or by a background thread, see start_background_thread. The background thread
+	 *	blocks in vkWaitSemaphores/vkWaitForFences and either invokes the callbacks itself, or leaves them
+	 *	to poll(), s.t. they are invoked on a thread of the application's choice (e.g., the main thread).
+	 *
+	 *	See also command_buffer_t::set_completion_handler.
+	 *	All functions are thread-safe.
+	 */
+	class completion_dispatcher
+	{
+	public:
+		completion_dispatcher() = default;
+		completion_dispatcher(completion_dispatcher&&) = delete;
+		completion_dispatcher(const completion_dispatcher&) = delete;
+		completion_dispatcher& operator=(completion_dispatcher&&) = delete;
+		completion_dispatcher& operator=(const completion_dispatcher&) = delete;
+		/** Stops the background thread, if any. Pending callbacks are not invoked. */
+		~completion_dispatcher();
+
+#if VK_HEADER_VERSION >= 135
+		/** Invoke the given callback once the given token has completed. */
+		void on_completion(const completion_token& aToken, avk::unique_function<void()> aCallback);
+#endif
+		/** Invoke the given callback once the given fence has been signaled. The fence is kept alive until then. */
+		void on_completion(fence aFence, avk::unique_function<void()> aCallback);
+
+		/**	Invoke the callbacks of all completed work on the calling thread. Does not block.
+		 *	While a background thread is running, only the callbacks of work which it has detected to be complete are invoked.
+		 *	@return	The number of callbacks which have been invoked
+		 */
+		size_t poll();
+
+		/**	Start a thread which waits for the pending work to complete.
+		 *	@param	aInvokeCallbacksOnBackgroundThread	If true, the background thread invokes the callbacks.
+		 *												If false, they are invoked by the next call to poll().
+		 *	@param	aMaxWaitTime						Work which is registered while the thread is blocked in a
+		 *												wait is considered after this time at the latest.
+		 *	If waiting fails on the background thread, the error is logged and the thread exits. Afterwards,
+		 *	poll() checks all pending work again, and the background thread can be started anew.
+		 */
+		void start_background_thread(bool aInvokeCallbacksOnBackgroundThread = true, std::chrono::microseconds aMaxWaitTime = std::chrono::milliseconds{ 1 });
+
+		/** Stop the background thread, if any. Pending callbacks stay registered. */
+		void stop_background_thread();
+
+		/** Number of callbacks which have not been invoked yet */
+		size_t number_of_pending_callbacks() const;
+
+	private:
+		struct entry
+		{
+#if VK_HEADER_VERSION >= 135
+			std::optional<completion_token> mToken;
+#endif
+			std::optional<fence> mFence;
+			avk::unique_function<void()> mCallback;
+			// Set by the background thread if it does not invoke the callbacks itself:
+			bool mCompleted = false;
+		};
+
+		static bool is_complete(const entry& aEntry);
+		void background_thread_loop(bool aInvokeCallbacks, std::chrono::microseconds aMaxWaitTime);
+
+		mutable std::mutex mMutex;
+		std::condition_variable mWorkAdded;
+		// In registration order. A list, s.t. the background thread can refer to entries while waiting:
+		std::list<entry> mEntries;
+		std::thread mBackgroundThread;
+		// Cleared by the background thread itself if it exits after an error; its thread object is joined later:
+		bool mBackgroundThreadRunning = false;
+		bool mStopBackgroundThread = false;
+	};
+}
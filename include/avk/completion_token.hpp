@@ -0,0 +1,56 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	// Forward declaration:
+	class queue;
+
+#if VK_HEADER_VERSION >= 135
+	/**	Refers to the completion of a submission: The submitted work has completed as soon as the
+	 *	timeline semaphore of mQueue has reached mValue. Tokens are cheap to copy and to compare,
+	 *	and they can be waited on by the CPU as well as by submissions to other queues.
+	 *	A default-constructed token does not refer to any work and is always complete.
+	 *	Get tokens from queue::submit_with_completion_token or sync::with_completion_token.
+	 */
+	struct completion_token
+	{
+		/** True if the work has completed. Does not block. */
+		bool is_complete() const;
+
+		/**	Block via vkWaitSemaphores until the work has completed.
+		 *	@param	aTimeout	Timeout in nanoseconds; waits indefinitely if not set
+		 *	@return	True if the work has completed, false if the timeout has elapsed
+		 */
+		bool wait(std::optional<uint64_t> aTimeout = {}) const;
+
+		/**	Block via one vkWaitSemaphores call until all of the given tokens have completed.
+		 *	All tokens must refer to queues of the same device.
+		 *	@return	True if all have completed, false if the timeout has elapsed
+		 */
+		static bool wait_for_all(const std::vector<completion_token>& aTokens, std::optional<uint64_t> aTimeout = {});
+
+		/**	Block via one vkWaitSemaphores call until at least one of the given tokens has completed.
+		 *	All tokens must refer to queues of the same device.
+		 *	@return	True if one has completed, false if the timeout has elapsed
+		 */
+		static bool wait_for_any(const std::vector<completion_token>& aTokens, std::optional<uint64_t> aTimeout = {});
+
+		const queue* mQueue = nullptr;
+		uint64_t mValue = 0;
+
+	private:
+		static bool wait_for(const std::vector<completion_token>& aTokens, vk::SemaphoreWaitFlags aFlags, std::optional<uint64_t> aTimeout);
+	};
+
+	static bool operator==(const completion_token& left, const completion_token& right)
+	{
+		return left.mQueue == right.mQueue && left.mValue == right.mValue;
+	}
+
+	static bool operator!=(const completion_token& left, const completion_token& right)
+	{
+		return !(left == right);
+	}
+#endif
+}
@@ -30,9 +30,13 @@ namespace avk
 		const auto& descriptor_set_layouts() const { return mAllDescriptorSetLayouts; }
 		const auto& push_constant_ranges() const { return mPushConstantRanges; }
 		const auto& layout_create_info() const { return mPipelineLayoutCreateInfo; }
-		const auto& layout_handle() const { return mPipelineLayout.get(); }
+		vk::PipelineLayout layout_handle() const { return mPipelineLayout ? mPipelineLayout->handle() : vk::PipelineLayout{}; }
+		/** The pipeline layout, which is shared with all pipelines that have identical resource bindings and push constants */
+		const auto& shared_layout() const { return mPipelineLayout; }
 		std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> layout() const { return std::make_tuple(this, layout_handle(), &mPushConstantRanges); }
 		auto handle() const  { return mPipeline.get(); }
+		/** Timing and cache information gathered during the most recent creation of this pipeline */
+		const auto& creation_feedback() const { return mCreationFeedback; }
 		
 		
 	private:
@@ -52,8 +56,11 @@ namespace avk
 		std::vector<vk::PushConstantRange> mPushConstantRanges;
 		vk::PipelineLayoutCreateInfo mPipelineLayoutCreateInfo;
 
+		// Gathered during creation:
+		pipeline_creation_feedback mCreationFeedback;
+
 		// Handles:
-		vk::UniqueHandle<vk::PipelineLayout, DISPATCH_LOADER_CORE_TYPE> mPipelineLayout;
+		std::shared_ptr<const shared_pipeline_layout> mPipelineLayout;
 		vk::UniqueHandle<vk::Pipeline,       DISPATCH_LOADER_CORE_TYPE> mPipeline;
 	};
 	
@@ -69,6 +76,22 @@ namespace avk
 	inline void command_buffer_t::bind_descriptors<std::tuple<const compute_pipeline_t*,  const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*>>
 		(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets)
 	{
-		bind_descriptors(vk::PipelineBindPoint::eCompute, std::get<const compute_pipeline_t*>(aPipelineLayout)->layout_handle(), std::move(aDescriptorSets));
+		bind_descriptors(vk::PipelineBindPoint::eCompute, std::get<const compute_pipeline_t*>(aPipelineLayout)->shared_layout(), std::move(aDescriptorSets));
+	}
+
+	template <>
+	inline void command_buffer_t::push_descriptors<std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*>>
+		(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::initializer_list<binding_data> aBindings, descriptor_cache& aFallbackCache, const root& aRoot)
+	{
+		push_descriptors(vk::PipelineBindPoint::eCompute, std::get<const compute_pipeline_t*>(aPipelineLayout)->shared_layout(), aBindings, aFallbackCache, aRoot);
+	}
+
+#if VK_HEADER_VERSION >= 235
+	template <>
+	inline void command_buffer_t::bind_descriptors<std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*>>
+		(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::initializer_list<binding_data> aBindings, descriptor_buffer& aDescriptorBuffer)
+	{
+		bind_descriptors(vk::PipelineBindPoint::eCompute, std::get<const compute_pipeline_t*>(aPipelineLayout)->shared_layout(), aBindings, aDescriptorBuffer);
 	}
+#endif
 }
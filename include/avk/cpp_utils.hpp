@@ -1049,6 +1049,21 @@ namespace avk
 		return static_cast<bool>(f);
 	}
 
+	/**	Invokes the given functions in inverse order of their addition and removes them.
+	 *	Used for custom deleters, which are kept in a flat list rather than being nested into each other.
+	 */
+	static void invoke_in_reverse_order_and_clear(std::vector<unique_function<void()>>& aFunctions)
+	{
+		// Take them out first, in case one of them adds further functions:
+		auto functions = std::move(aFunctions);
+		aFunctions.clear();
+		for (auto it = functions.rbegin(); it != functions.rend(); ++it) {
+			if (*it) {
+				(*it)();
+			}
+		}
+	}
+
 	/*	Combines multiple hash values.
 	 *  Inspiration and implementation largely taken from: https://stackoverflow.com/questions/2590677/how-do-i-combine-hash-values-in-c0x/54728293#54728293
 	 *  TODO: Should a larger magic constant be used since we're only supporting x64 and hence, size_t will always be 64bit?!
@@ -0,0 +1,108 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Defers the destruction of resources until the GPU is done with them. Resources are moved into
+	 *	buckets, one per completion point (a fence or a completion_token), and all resources of a bucket
+	 *	are destroyed at once by collect() after the GPU has passed the bucket's completion point.
+	 *	This is a flat alternative to keeping resources alive via custom deleters of command buffers,
+	 *	semaphores, or fences, e.g.:
+	 *	  avk::sync::with_completion_token([&myDeletionQueue](avk::completion_token t, avk::command_buffer cb) {
+	 *	      myDeletionQueue.destroy_after(t, std::move(cb));
+	 *	  })
+	 *
+	 *	Call collect() regularly, e.g., once per frame. Resources which are still in the queue when it is
+	 *	destroyed are destroyed along with it, regardless of whether the GPU is done with them.
+	 *	All functions are thread-safe.
+	 */
+	class deletion_queue
+	{
+	public:
+		deletion_queue();
+		deletion_queue(deletion_queue&&) noexcept = default;
+		deletion_queue(const deletion_queue&) = delete;
+		deletion_queue& operator=(deletion_queue&&) noexcept = default;
+		deletion_queue& operator=(const deletion_queue&) = delete;
+		~deletion_queue() = default;
+
+		/**	Destroy the given resources after the given fence has been signaled.
+		 *	The fence is kept alive until then, and destroyed after them.
+		 */
+		template <typename... Ts>
+		void destroy_after(fence aFence, Ts&&... aResources)
+		{
+			std::vector<std::unique_ptr<erased_resource>> resources;
+			resources.reserve(sizeof...(Ts));
+			(resources.push_back(make_erased(std::forward<Ts>(aResources))), ...);
+			add_fence_bucket(std::move(aFence), std::move(resources));
+		}
+
+#if VK_HEADER_VERSION >= 135
+		/** Destroy the given resources after the given token has completed. */
+		template <typename... Ts>
+		void destroy_after(const completion_token& aToken, Ts&&... aResources)
+		{
+			std::vector<std::unique_ptr<erased_resource>> resources;
+			resources.reserve(sizeof...(Ts));
+			(resources.push_back(make_erased(std::forward<Ts>(aResources))), ...);
+			add_to_token_bucket(aToken, std::move(resources));
+		}
+#endif
+
+		/**	Destroy the resources of all buckets whose completion points the GPU has passed. Does not block.
+		 *	@return	The number of resources which have been destroyed
+		 */
+		size_t collect();
+
+		/** Number of resources which are awaiting their destruction */
+		size_t size() const;
+
+	private:
+		// Type-erased owner of one resource:
+		struct erased_resource
+		{
+			virtual ~erased_resource() = default;
+		};
+
+		template <typename T>
+		struct erased_resource_of : erased_resource
+		{
+			template <typename U>
+			explicit erased_resource_of(U&& aResource) : mResource{ std::forward<U>(aResource) } {}
+			T mResource;
+		};
+
+		template <typename T>
+		static std::unique_ptr<erased_resource> make_erased(T&& aResource)
+		{
+			return std::make_unique<erased_resource_of<std::decay_t<T>>>(std::forward<T>(aResource));
+		}
+
+		struct fence_bucket
+		{
+			fence mFence;
+			std::vector<std::unique_ptr<erased_resource>> mResources;
+		};
+
+		void add_fence_bucket(fence aFence, std::vector<std::unique_ptr<erased_resource>> aResources);
+
+#if VK_HEADER_VERSION >= 135
+		struct token_bucket
+		{
+			completion_token mToken;
+			std::vector<std::unique_ptr<erased_resource>> mResources;
+		};
+
+		void add_to_token_bucket(const completion_token& aToken, std::vector<std::unique_ptr<erased_resource>> aResources);
+#endif
+
+		// Held via unique_ptr to keep the deletion queue movable:
+		std::unique_ptr<std::mutex> mMutex;
+		std::vector<fence_bucket> mFenceBuckets;
+#if VK_HEADER_VERSION >= 135
+		std::vector<token_bucket> mTokenBuckets;
+#endif
+		size_t mNumberOfResources = 0;
+	};
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+#if VK_HEADER_VERSION >= 235
+	/**	A persistently mapped ring buffer, into which descriptors are written directly via vkGetDescriptorEXT
+	 *	(VK_EXT_descriptor_buffer). It is an alternative to descriptor sets: There are no pools to manage and
+	 *	no vkUpdateDescriptorSets calls; writing a set is a matter of copying a few bytes per descriptor.
+	 *
+	 *	Each frame in flight owns one region of the buffer. Sets are bump-allocated from the current frame's
+	 *	region and are all discarded at once when the frame's slot comes around again in begin_frame().
+	 *	Bind sets via command_buffer_t::bind_descriptors with a descriptor_buffer argument. Pipelines which are
+	 *	used that way must have been created with cfg::pipeline_settings::descriptor_buffer.
+	 *
+	 *	Requirements: The descriptorBuffer and bufferDeviceAddress features must be enabled. Buffers which are
+	 *	bound as uniform, storage, or texel buffers must have been created with eShaderDeviceAddress.
+	 *	A descriptor_buffer is not thread-safe. Use one per recording thread.
+	 *	Create instances via root::create_descriptor_buffer.
+	 */
+	class descriptor_buffer
+	{
+		friend class root;
+		friend class command_buffer_t;
+
+	public:
+		descriptor_buffer() = default;
+		descriptor_buffer(descriptor_buffer&&) noexcept = default;
+		descriptor_buffer(const descriptor_buffer&) = delete;
+		descriptor_buffer& operator=(descriptor_buffer&&) noexcept = default;
+		descriptor_buffer& operator=(const descriptor_buffer&) = delete;
+		~descriptor_buffer() = default;
+
+		auto frames_in_flight() const { return mFramesInFlight; }
+		auto current_frame_index() const { return mCurrentFrameIndex; }
+		auto bytes_per_frame() const { return mBytesPerFrame; }
+		/** Number of bytes which have been allocated from the current frame's region so far */
+		auto bytes_used() const { return mFrameOffset; }
+		vk::Buffer handle() const { return mBuffer->handle(); }
+		auto device_address() const { return mBuffer->device_address(); }
+		const auto& properties() const { return mProperties; }
+
+		/**	Start writing into the given frame's region. All sets which have been written into the same region
+		 *	(i.e., for frame aFrameId - frames_in_flight()) are discarded. Call it after the fence of that earlier
+		 *	frame has been signaled.
+		 *	@param	aFrameId	Monotonically increasing frame number. Its region is aFrameId % frames_in_flight().
+		 */
+		void begin_frame(uint64_t aFrameId);
+
+		/**	Write the descriptors of one set into the current frame's region.
+		 *	@param	aLayout		The pipeline layout, whose set layout at aSetId must have been created for descriptor buffers
+		 *	@param	aBegin		First binding of the set; all bindings in [aBegin, aEnd) must have the set-id aSetId
+		 *	@return	The set's offset from the start of the buffer, as to be passed to vkCmdSetDescriptorBufferOffsetsEXT
+		 */
+		vk::DeviceSize write_descriptor_set(const shared_pipeline_layout& aLayout, uint32_t aSetId, const binding_data* const* aBegin, const binding_data* const* aEnd);
+
+	private:
+		// Size and binding offsets of one descriptor set layout, as reported by the driver:
+		struct set_layout_info
+		{
+			// Keeps the layout alive, s.t. its handle can not be reused for a different layout:
+			layout_registry::descriptor_set_layout_handle mLayout;
+			vk::DeviceSize mSize;
+			// Binding ids and their offsets within a set, ordered by binding id. Queried on first use:
+			std::vector<std::tuple<uint32_t, vk::DeviceSize>> mBindingOffsets;
+		};
+
+		set_layout_info& info_for(const layout_registry::descriptor_set_layout_handle& aLayout);
+		vk::DeviceSize binding_offset(set_layout_info& aInfo, uint32_t aBinding);
+		size_t descriptor_size(vk::DescriptorType aType) const;
+		vk::DeviceSize allocate(vk::DeviceSize aSize);
+
+		const root* mRoot;
+		vk::PhysicalDeviceDescriptorBufferPropertiesEXT mProperties;
+		// Descriptors of uniform and storage buffers have different sizes if robustBufferAccess is enabled:
+		bool mRobustBufferAccess;
+		uint32_t mFramesInFlight;
+		vk::DeviceSize mBytesPerFrame;
+		size_t mCurrentFrameIndex = 0;
+		vk::DeviceSize mFrameOffset = 0;
+		buffer mBuffer;
+		// Declared after the buffer, s.t. it is unmapped before the buffer is destroyed:
+		std::optional<scoped_mapping<AVK_MEM_BUFFER_HANDLE>> mMapping;
+		std::byte* mMappedData = nullptr;
+		std::unordered_map<VkDescriptorSetLayout, set_layout_info> mSetLayoutInfos;
+	};
+#endif
+}
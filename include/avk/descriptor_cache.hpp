@@ -4,62 +4,238 @@
 namespace avk
 {
 	/**	This is a ready-to-use implementation for a descriptor cache.
-	 *  The cache is prepared for concurrent access from multiple threads
+	 *  The cache can be accessed concurrently from multiple threads
 	 *  and it will create one or multiple descriptor pools per thread.
 	 *
 	 *  Descriptor pools are not shared across threads, but always exclusive
 	 *  for a certain thread.
 	 *
-	 *  The allocated pools are rather tightly sized and fit to incoming requests.
-	 *  This might or might not be the desired behavior. If the descriptors that
-	 *  you pass to shaders do not change a lot during the runtime of the program,
-	 *  this behavior might be well suited.
-	 *  If, however, you have to pass constantly changing descriptors, you might
-	 *  experience too many descriptor pool allocations which can lead to bad
-	 *  performance.
+	 *  Cached layouts and sets are distributed across multiple shards by their
+	 *  hashes, each protected by a reader-writer lock. Cache hits only take a
+	 *  shared lock on one shard, so that lookups from multiple threads do not
+	 *  block each other. Lookups via the bindings do not even need to prepare
+	 *  the sets first, s.t. a fully cached request does not allocate.
 	 *
-	 *  You can control the pool size with set_prealloc_factor().
-	 *  However, the pool still only allocates descriptor types according to the
-	 *  incoming request (just prealloc_factor-times many of them).
+	 *  Pools are sized adaptively per thread: The first pool of a thread holds
+	 *  prealloc_factor() times the sets of the request which created it. Every
+	 *  further pool of the same thread holds twice as many sets as the previous
+	 *  one (up to 4096 sets), and its descriptor counts follow the mix
+	 *  of descriptor types which has been requested on that thread so far.
+	 *  Thereby, the number of pools grows only logarithmically with the number
+	 *  of sets, and descriptor types which are never requested are not reserved.
+	 *
+	 *  You can control the initial pool size with set_prealloc_factor().
 	 *  If your application's requirements diverge too much from the assumptions
 	 *  of this descriptor_cache, consider implementing a different descriptor
 	 *  cache class or in general, handle it manually.
 	 *
+	 *  By default, the number of cached sets is unbounded. For long-running
+	 *  applications with constantly changing bindings, limit it with
+	 *  set_max_number_of_sets() and call next_frame() once per frame. Least
+	 *  recently used sets are evicted then, except for those which might still
+	 *  be used by frames in flight. Pools which no set refers to anymore are
+	 *  reset and reused for subsequent allocations.
+	 *  Attention: With a limit, request the sets from the cache every frame,
+	 *  instead of holding on to them across frames.
+	 *
 	 */
 	class descriptor_cache
 	{
 		friend class root;
 		
 	public:
+		descriptor_cache() = default;
+		descriptor_cache(descriptor_cache&&) noexcept = default;
+		descriptor_cache(const descriptor_cache&) = delete;
+		descriptor_cache& operator=(descriptor_cache&&) noexcept = default;
+		descriptor_cache& operator=(const descriptor_cache&) = delete;
+		~descriptor_cache() = default;
+
 		auto prealloc_factor() const { return mPreallocFactor; }
+		/** Not thread-safe, set it before the cache is being used from multiple threads. */
 		void set_prealloc_factor(int aFactor) { mPreallocFactor = aFactor; }
+
+		auto max_number_of_sets() const { return mMaxNumberOfSets; }
+		auto frames_in_flight() const { return mFramesInFlight; }
+		/**	Limit the number of cached sets. The limit is enforced in next_frame().
+		 *	@param	aMaxNumberOfSets	Maximum number of cached sets, 0 means unlimited (the default)
+		 *	@param	aFramesInFlight		Sets which have been requested during this many most recent frames
+		 *								(including the current one) are never evicted.
+		 *	Not thread-safe, set it before the cache is being used from multiple threads.
+		 */
+		void set_max_number_of_sets(size_t aMaxNumberOfSets, uint32_t aFramesInFlight)
+		{
+			mMaxNumberOfSets = aMaxNumberOfSets;
+			mFramesInFlight = std::max(aFramesInFlight, 1u);
+		}
+
+		auto current_frame() const { return mState->mCurrentFrame.load(std::memory_order_relaxed); }
+		/**	Advance to the next frame and, if the number of cached sets exceeds the limit, evict the least
+		 *	recently used ones which are no longer used by any frame in flight.
+		 *	Call it once per frame, after the oldest frame in flight has completed.
+		 *	@return	The number of evicted sets
+		 */
+		size_t next_frame();
 		
 		const descriptor_set_layout& get_or_alloc_layout(descriptor_set_layout aPreparedLayout);
 		std::optional<descriptor_set> get_descriptor_set_from_cache(const descriptor_set& aPreparedSet);
 		std::vector<descriptor_set> alloc_new_descriptor_sets(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts, std::vector<descriptor_set> aPreparedSets);
+		/** Remove all cached sets and layouts. Attention: No other thread may use the cache concurrently. */
 		void cleanup();
 		
 		std::shared_ptr<descriptor_pool> get_descriptor_pool_for_layouts(const descriptor_alloc_request& aAllocRequest, bool aRequestNewPool = false);
 
 		std::vector<descriptor_set> get_or_create_descriptor_sets(std::initializer_list<binding_data> aBindings);
 
+		/**	Get the descriptor sets for the given bindings, creating those which are not cached yet.
+		 *	If all sets are cached, and aResult is reused across calls (s.t. it has enough capacity),
+		 *	this does not perform any heap allocations.
+		 *	@param	aBindings	The bindings of all sets
+		 *	@param	aResult		Receives the sets, ordered by set-id. Its previous contents are discarded.
+		 */
+		void get_or_create_descriptor_sets(std::initializer_list<binding_data> aBindings, std::vector<descriptor_set>& aResult);
+
+		/**	Get the descriptor sets for the given bindings, which must already be ordered by set-id and binding-id.
+		 *	@param	aOrderedBindings	Pointers to aNumBindings bindings
+		 *	@param	aResult				Receives the sets, ordered by set-id. Its previous contents are discarded.
+		 */
+		void get_or_create_descriptor_sets(const binding_data* const* aOrderedBindings, size_t aNumBindings, std::vector<descriptor_set>& aResult);
+
 		int remove_sets_with_handle(vk::ImageView aHandle);
 		int remove_sets_with_handle(vk::Buffer aHandle);
 		int remove_sets_with_handle(vk::Sampler aHandle);
 		int remove_sets_with_handle(vk::BufferView aHandle);
+
+		/**	Remove all cached sets which refer to any of the given handles, in one pass over the cache.
+		 *	@tparam	H	vk::ImageView, vk::Buffer, vk::Sampler, or vk::BufferView
+		 *	@return	The number of removed sets
+		 */
+		template <typename H>
+		int remove_sets_with_handles(const std::vector<H>& aHandles)
+		{
+			std::vector<handle_key> keys;
+			keys.reserve(aHandles.size());
+			for (const auto& h : aHandles) {
+				keys.push_back(key_of(h));
+			}
+			return remove_sets_with_keys(keys);
+		}
 		
 	private:
+		static constexpr size_t sNumberOfShards = 16;
+
+		/** A handle of a resource which cached sets refer to, tagged with its type */
+		struct handle_key
+		{
+			vk::ObjectType mType;
+			uint64_t mHandle;
+			bool operator==(const handle_key& aOther) const = default;
+		};
+
+		struct handle_key_hash
+		{
+			size_t operator()(const handle_key& aKey) const noexcept
+			{
+				size_t h = 0;
+				hash_combine(h, static_cast<int32_t>(aKey.mType), aKey.mHandle);
+				return h;
+			}
+		};
+
+		/** A cached set, and the frame in which it has been requested most recently */
+		struct cached_set
+		{
+			cached_set(descriptor_set aSet, uint64_t aFrame) : mSet{ std::move(aSet) }, mLastUsedFrame{ aFrame } {}
+			descriptor_set mSet;
+			// Updated on cache hits, which only hold a shared lock:
+			mutable std::atomic<uint64_t> mLastUsedFrame;
+		};
+
+		/** A part of the cached layouts and sets. The shard of an entry is determined by its hash. */
+		struct shard
+		{
+			std::shared_mutex mMutex;
+			// Keyed by their hashes, s.t. they can also be looked up from bindings without preparing them first:
+			std::unordered_multimap<size_t, descriptor_set_layout> mLayouts;
+			std::unordered_multimap<uint64_t, cached_set> mSets;
+			// Reverse index: For each resource handle, the sets of mSets which refer to it (once per reference):
+			std::unordered_multimap<handle_key, const descriptor_set*, handle_key_hash> mSetsByHandle;
+		};
+
+		/** Upper bound for the number of sets of one pool, which grows geometrically */
+		static constexpr uint32_t sMaxSetsPerPool = 4096u;
+
+		// The descriptor pools of one thread, and the demand observed on that thread. Only ever accessed by that thread.
+		struct pool_list
+		{
+			std::vector<std::weak_ptr<descriptor_pool>> mPools;
+			// Accumulated descriptor counts per type and number of sets of all requests which required new sets:
+			std::vector<vk::DescriptorPoolSize> mObservedSizes;
+			uint64_t mObservedSets = 0;
+			// Number of sets of the most recently created pool:
+			uint32_t mLastPoolSets = 0;
+		};
+
+		// Pools which no set refers to anymore, already reset. Shared with the pools' deleters, which might outlive the cache.
+		struct pool_recycler
+		{
+			static constexpr size_t sMaxNumberOfPools = 16;
+			std::mutex mMutex;
+			std::vector<std::unique_ptr<descriptor_pool>> mPools;
+		};
+
+		// All data which is accessed concurrently. Stored behind a pointer, s.t. the cache stays movable.
+		struct concurrent_state
+		{
+			std::array<shard, sNumberOfShards> mShards;
+			std::shared_mutex mPoolListsMutex;
+			std::unordered_map<std::thread::id, std::unique_ptr<pool_list>> mPoolLists;
+			std::atomic<uint64_t> mCurrentFrame{ 0 };
+			std::shared_ptr<pool_recycler> mRecycler = std::make_shared<pool_recycler>();
+		};
+
+		static uint64_t next_id();
+		shard& shard_for(uint64_t aHash) { return mState->mShards[aHash % sNumberOfShards]; }
+		pool_list& pools_of_this_thread();
+		// Add the given request to the demand observed on this thread, which determines the sizes of new pools:
+		void observe_demand(const descriptor_alloc_request& aAllocRequest);
+
+		// Looks up a cached set which writes exactly the given (ordered) bindings of one set. Does not allocate.
+		bool find_cached_set(const binding_data* const* aBegin, const binding_data* const* aEnd, uint64_t aContentHash, descriptor_set& aOutSet);
+
+		template <typename H>
+		static handle_key key_of(H aHandle)
+		{
+			return handle_key{ H::objectType, reinterpret_cast<uint64_t>(static_cast<typename H::CType>(aHandle)) };
+		}
+
+		// Invokes aFunc with the key of each resource handle which the given set refers to:
+		template <typename F>
+		static void for_each_handle_key(const descriptor_set& aSet, F&& aFunc);
+
+		// Add the given set, which must be stored in the given shard's mSets, to the reverse index:
+		static void index_set(shard& aShard, const descriptor_set& aSet);
+		// Remove the given set from the shard and from its reverse index. The shard must be locked exclusively.
+		static void erase_set(shard& aShard, const descriptor_set* aSet);
+		int remove_sets_with_keys(const std::vector<handle_key>& aKeys);
+
+		void touch(const cached_set& aEntry) const { aEntry.mLastUsedFrame.store(current_frame(), std::memory_order_relaxed); }
+		// Wrap the pool s.t. it is handed to the recycler instead of being destroyed once no set refers to it anymore:
+		std::shared_ptr<descriptor_pool> make_recyclable(descriptor_pool aPool);
+		std::shared_ptr<descriptor_pool> take_recycled_pool(const descriptor_alloc_request& aAllocRequest);
+
 		std::string mName = "descriptor cache";
 		int mPreallocFactor = 5;
+		size_t mMaxNumberOfSets = 0;
+		uint32_t mFramesInFlight = 1;
 		const root* mRoot;
-		
-		std::unordered_set<descriptor_set_layout> mLayouts;
-		std::unordered_set<descriptor_set> mSets;
+		// Unique across all descriptor caches; identifies this cache in thread-local lookups:
+		uint64_t mId = next_id();
 		
 		// Descriptor pools are created/stored per thread and can have a name (an integer-id). 
 		// If possible, it is tried to re-use a pool. Even when re-using a pool, it might happen that
 		// allocating from it might fail (because out of memory, for instance). In such cases, a new 
 		// pool will be created.
-		std::unordered_map<std::thread::id, std::vector<std::weak_ptr<descriptor_pool>>> mDescriptorPools;
+		std::unique_ptr<concurrent_state> mState = std::make_unique<concurrent_state>();
 	};
 }
@@ -28,6 +28,12 @@ namespace avk
 		
 		std::vector<vk::DescriptorSet> allocate(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts);
 
+		/**	Allocate sets of the given layouts, without throwing if the pool is exhausted.
+		 *	@param	aResult		Receives one handle per layout if successful
+		 *	@return	eSuccess, or the error of vkAllocateDescriptorSets, like eErrorOutOfPoolMemory or eErrorFragmentedPool
+		 */
+		vk::Result try_allocate(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts, std::vector<vk::DescriptorSet>& aResult);
+
 		/**	Resets this descriptor pool, freeing all descriptor sets that have been allocated from it.
 		 *	Also sets remaining capacities to initial capacities.
 		 *	Use at your own risk!
@@ -35,6 +41,9 @@ namespace avk
 		void reset();
 
 	private:
+		// Subtract the descriptors and sets of the given layouts from the remaining capacities:
+		void consume_capacities_for(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts);
+
 		vk::UniqueHandle<vk::DescriptorPool, DISPATCH_LOADER_CORE_TYPE> mDescriptorPool;
 		std::vector<vk::DescriptorPoolSize> mInitialCapacities;
 		std::vector<vk::DescriptorPoolSize> mRemainingCapacities;
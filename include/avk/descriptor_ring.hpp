@@ -0,0 +1,76 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	An allocator for transient descriptor sets, i.e., sets which are only used during one frame,
+	 *	like the ones for dynamic per-draw bindings.
+	 *
+	 *	Each frame in flight owns its own descriptor pools. Sets are allocated from the current
+	 *	frame's pools without any hashing or caching, and all of them are freed at once, by resetting
+	 *	the pools, when the frame's slot comes around again in begin_frame().
+	 *
+	 *	Attention: Sets allocated from the ring must not be used after their frame's pools have been
+	 *	reset, i.e., they must not be held on to across frames. Use a descriptor_cache for sets which
+	 *	are reused across frames.
+	 *
+	 *	A descriptor_ring is not thread-safe. Use one ring per recording thread.
+	 */
+	class descriptor_ring
+	{
+		friend class root;
+
+	public:
+		descriptor_ring() = default;
+		descriptor_ring(descriptor_ring&&) noexcept = default;
+		descriptor_ring(const descriptor_ring&) = delete;
+		descriptor_ring& operator=(descriptor_ring&&) noexcept = default;
+		descriptor_ring& operator=(const descriptor_ring&) = delete;
+		~descriptor_ring() = default;
+
+		auto frames_in_flight() const { return static_cast<uint32_t>(mFrames.size()); }
+		auto current_frame_index() const { return mCurrentFrameIndex; }
+		auto sets_per_pool() const { return mSetsPerPool; }
+		/** Number of pools which the given frame slot owns */
+		auto number_of_pools(size_t aFrameIndex) const { return mFrames[aFrameIndex].mPools.size(); }
+
+		/**	Start allocating for the given frame. All sets which have been allocated in the same slot
+		 *	(i.e., for frame aFrameId - frames_in_flight()) are freed by resetting the slot's pools.
+		 *	Call it after the fence of that earlier frame has been signaled.
+		 *	@param	aFrameId	Monotonically increasing frame number. Its slot is aFrameId % frames_in_flight().
+		 */
+		void begin_frame(uint64_t aFrameId);
+
+		/**	Allocate and write descriptor sets for the given bindings from the current frame's pools.
+		 *	@return	The sets, ordered by set-id
+		 */
+		std::vector<descriptor_set> allocate_descriptor_sets(std::initializer_list<binding_data> aBindings);
+
+		/**	Allocate and write descriptor sets for the given bindings from the current frame's pools.
+		 *	@param	aResult		Receives the sets, ordered by set-id. Its previous contents are discarded.
+		 */
+		void allocate_descriptor_sets(std::initializer_list<binding_data> aBindings, std::vector<descriptor_set>& aResult);
+
+	private:
+		struct frame_pools
+		{
+			std::vector<std::shared_ptr<descriptor_pool>> mPools;
+			// Sets are only allocated from this pool and the ones after it:
+			size_t mCurrentPool = 0;
+		};
+
+		const descriptor_set_layout& get_or_alloc_layout(const binding_data* const* aBegin, const binding_data* const* aEnd);
+		const std::shared_ptr<descriptor_pool>& pool_for(const descriptor_alloc_request& aAllocRequest);
+		const std::shared_ptr<descriptor_pool>& add_pool(const descriptor_alloc_request& aAllocRequest);
+
+		std::string mName;
+		const root* mRoot;
+		uint32_t mSetsPerPool;
+		std::vector<frame_pools> mFrames;
+		size_t mCurrentFrameIndex = 0;
+		// Capacities of new pools. They grow with the descriptor types and counts of incoming requests.
+		std::vector<vk::DescriptorPoolSize> mPoolSizes;
+		// Layouts live as long as the ring, keyed by a hash over their bindings:
+		std::unordered_multimap<size_t, descriptor_set_layout> mLayouts;
+	};
+}
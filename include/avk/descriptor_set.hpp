@@ -3,7 +3,11 @@
 
 namespace avk
 {
-	/** Descriptor set */
+	/**	Descriptor set
+	 *	The writes and the descriptor data they point to are shared between copies of a
+	 *	descriptor_set and only copied when a copy is modified. Therefore, copying a
+	 *	descriptor_set (e.g., when it is returned from a descriptor_cache) is cheap.
+	 */
 	class descriptor_set
 	{
 		friend bool operator ==(const descriptor_set& left, const descriptor_set& right);
@@ -18,85 +22,84 @@ namespace avk
 		descriptor_set& operator=(const descriptor_set&) = default;
 		~descriptor_set() = default;
 
-		auto number_of_writes() const { return mOrderedDescriptorDataWrites.size(); }
-		const auto& write_at(size_t i) const { return mOrderedDescriptorDataWrites[i]; }
+		auto number_of_writes() const { return static_cast<bool>(mData) ? mData->mOrderedDescriptorDataWrites.size() : size_t{ 0 }; }
+		const auto& write_at(size_t i) const { return mData->mOrderedDescriptorDataWrites[i]; }
 		const auto* pool() const { return static_cast<bool>(mPool) ? mPool.get() : nullptr; }
 		auto handle() const { return mDescriptorSet; }
 		auto set_id() const { return mSetId; }
 		void set_set_id(uint32_t aNewSetId) { mSetId = aNewSetId; }
+		/** 64-bit hash over the descriptor data of all writes, combined from the bindings' binding_data::content_hash */
+		auto content_hash() const { return mContentHash; }
+
+		/** Combines the content hash of the preceding bindings of a set with the one of its next binding, like prepare does. */
+		static uint64_t combine_content_hash(uint64_t aPrecedingHash, const binding_data& aNextBinding)
+		{
+			size_t h = static_cast<size_t>(aPrecedingHash);
+			hash_combine(h, aNextBinding.content_hash());
+			return static_cast<uint64_t>(h);
+		}
 
 		const auto* store_image_infos(uint32_t aBindingId, std::vector<vk::DescriptorImageInfo> aStoredImageInfos)
 		{
-			auto& back = mStoredImageInfos.emplace_back(aBindingId, std::move(aStoredImageInfos));
-			return std::get<std::vector<vk::DescriptorImageInfo>>(back).data();
+			return store_payload(aBindingId, payload_kind::image_infos, aStoredImageInfos.data(), aStoredImageInfos.size());
 		}
 		
 		const auto* store_buffer_infos(uint32_t aBindingId, std::vector<vk::DescriptorBufferInfo> aStoredBufferInfos)
 		{
-			auto& back = mStoredBufferInfos.emplace_back(aBindingId, std::move(aStoredBufferInfos));
-			return std::get<std::vector<vk::DescriptorBufferInfo>>(back).data();
+			return store_payload(aBindingId, payload_kind::buffer_infos, aStoredBufferInfos.data(), aStoredBufferInfos.size());
 		}
 		
 #if VK_HEADER_VERSION >= 135
 		const vk::WriteDescriptorSetAccelerationStructureKHR* store_acceleration_structure_infos(uint32_t aBindingId, std::vector<vk::WriteDescriptorSetAccelerationStructureKHR> aWriteAccelerationStructureInfos)
 		{
 			// Accumulate all into ONE! (At least I think "This is the way.")
-			std::tuple<vk::WriteDescriptorSetAccelerationStructureKHR, std::vector<vk::AccelerationStructureKHR>> oneAndOnlyWrite;
-
+			std::vector<vk::AccelerationStructureKHR> accStructureHandles;
 			for (auto& wasi : aWriteAccelerationStructureInfos) {
 				for (uint32_t i = 0u; i < wasi.accelerationStructureCount; ++i) {
-					std::get<std::vector<vk::AccelerationStructureKHR>>(oneAndOnlyWrite).push_back(wasi.pAccelerationStructures[i]);
+					accStructureHandles.push_back(wasi.pAccelerationStructures[i]);
 				}
 			}
-
-			std::get<vk::WriteDescriptorSetAccelerationStructureKHR>(oneAndOnlyWrite).accelerationStructureCount = static_cast<uint32_t>(std::get<std::vector<vk::AccelerationStructureKHR>>(oneAndOnlyWrite).size());
-			
-			auto& back = mStoredAccelerationStructureWrites.emplace_back(aBindingId, std::move(oneAndOnlyWrite));
-			return &std::get<vk::WriteDescriptorSetAccelerationStructureKHR>(std::get<1>(back));
+			return store_acceleration_structures(aBindingId, accStructureHandles.data(), accStructureHandles.size());
 		}
 #endif
 
 		const auto* store_buffer_views(uint32_t aBindingId, std::vector<vk::BufferView> aStoredBufferViews)
 		{
-			auto& back = mStoredBufferViews.emplace_back(aBindingId, std::move(aStoredBufferViews));
-			return std::get<std::vector<vk::BufferView>>(back).data();
+			return store_payload(aBindingId, payload_kind::buffer_views, aStoredBufferViews.data(), aStoredBufferViews.size());
 		}
 
 		const auto* store_image_info(uint32_t aBindingId, const vk::DescriptorImageInfo& aStoredImageInfo)
 		{
-			auto& back = mStoredImageInfos.emplace_back(aBindingId, avk::make_vector( aStoredImageInfo ));
-			return std::get<std::vector<vk::DescriptorImageInfo>>(back).data();
+			return store_payload(aBindingId, payload_kind::image_infos, &aStoredImageInfo, 1);
 		}
 		
 		const auto* store_buffer_info(uint32_t aBindingId, const vk::DescriptorBufferInfo& aStoredBufferInfo)
 		{
-			auto& back = mStoredBufferInfos.emplace_back(aBindingId, avk::make_vector( aStoredBufferInfo ));
-			return std::get<std::vector<vk::DescriptorBufferInfo>>(back).data();
+			return store_payload(aBindingId, payload_kind::buffer_infos, &aStoredBufferInfo, 1);
 		}
 		
 #if VK_HEADER_VERSION >= 135
 		const vk::WriteDescriptorSetAccelerationStructureKHR* store_acceleration_structure_info(uint32_t aBindingId, const vk::WriteDescriptorSetAccelerationStructureKHR& aWriteAccelerationStructureInfo)
 		{
-			std::vector<vk::AccelerationStructureKHR> accStructureHandles;
-			for (uint32_t i = 0u; i < aWriteAccelerationStructureInfo.accelerationStructureCount; ++i) {
-				accStructureHandles.push_back(aWriteAccelerationStructureInfo.pAccelerationStructures[i]);
-			}
-
-			auto theWrite = std::make_tuple<vk::WriteDescriptorSetAccelerationStructureKHR, std::vector<vk::AccelerationStructureKHR>>(
-				vk::WriteDescriptorSetAccelerationStructureKHR{aWriteAccelerationStructureInfo}, std::move(accStructureHandles)
-			);
-			
-			auto& back = mStoredAccelerationStructureWrites.emplace_back(aBindingId, std::move(theWrite));
-			return &std::get<vk::WriteDescriptorSetAccelerationStructureKHR>(std::get<1>(back));
+			return store_acceleration_structures(aBindingId, aWriteAccelerationStructureInfo.pAccelerationStructures, aWriteAccelerationStructureInfo.accelerationStructureCount);
 		}
 #endif
 
 		const auto* store_buffer_view(uint32_t aBindingId, const vk::BufferView& aStoredBufferView)
 		{
-			auto& back = mStoredBufferViews.emplace_back(aBindingId, avk::make_vector( aStoredBufferView ));
-			return std::get<std::vector<vk::BufferView>>(back).data();
+			return store_payload(aBindingId, payload_kind::buffer_views, &aStoredBufferView, 1);
 		}
 
+		/** The descriptor data of all writes, packed in the layout which descriptor set layouts' update templates expect */
+		const void* payload() const { return static_cast<bool>(mData) ? mData->mPayload.data() : nullptr; }
+
+		/**	Stride and alignment of the descriptor data of the given type within the payload, or 0 if
+		 *	descriptors of that type can not be written via the payload.
+		 */
+		static size_t payload_stride(vk::DescriptorType aType);
+		/** Size of the payload which holds aCount descriptors of the given type */
+		static size_t payload_size(vk::DescriptorType aType, uint32_t aCount) { return (payload_stride(aType) * aCount + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t); }
+
 		void update_data_pointers();
 		
 		template <typename It>
@@ -113,7 +116,7 @@ namespace avk
 				assert((it+1) == end || b.mLayoutBinding.binding != (it+1)->mLayoutBinding.binding);
 				assert((it+1) == end || b.mLayoutBinding.binding < (it+1)->mLayoutBinding.binding);
 
-				result.mOrderedDescriptorDataWrites.emplace_back(
+				result.mutable_data().mOrderedDescriptorDataWrites.emplace_back(
 					vk::DescriptorSet{}, // To be set before actually writing
 					b.mLayoutBinding.binding,
 					0u, // TODO: Maybe support other array offsets
@@ -123,7 +126,8 @@ namespace avk
 					b.descriptor_buffer_info(result),
 					b.texel_buffer_view_info(result)
 				);
-				result.mOrderedDescriptorDataWrites.back().setPNext(b.next_pointer(result));
+				result.mutable_data().mOrderedDescriptorDataWrites.back().setPNext(b.next_pointer(result));
+				result.mContentHash = combine_content_hash(result.mContentHash, b);
 				
 				++it;
 			}
@@ -133,21 +137,78 @@ namespace avk
 		}
 
 		void link_to_handle_and_pool(vk::DescriptorSet aHandle, std::shared_ptr<descriptor_pool> aPool);
+		/** Write the descriptors via vkUpdateDescriptorSets */
 		void write_descriptors();
+		/**	Write the descriptors with one vkUpdateDescriptorSetWithTemplate call, using the given layout's update template.
+		 *	Falls back to vkUpdateDescriptorSets if the layout has no update template, or if this set's writes do not match it.
+		 */
+		void write_descriptors(const descriptor_set_layout& aLayout);
+		/** Returns true if this set's payload has exactly the layout which the given layout's update template expects */
+		bool matches_update_template_of(const descriptor_set_layout& aLayout) const;
 		
 	private:
-		std::vector<vk::WriteDescriptorSet> mOrderedDescriptorDataWrites;
+		enum struct payload_kind { image_infos, buffer_infos, buffer_views, acceleration_structures };
+
+		// Where the descriptor data of one binding is stored within the payload:
+		struct payload_entry
+		{
+			uint32_t mBinding;
+			payload_kind mKind;
+			uint32_t mOffset;
+			uint32_t mCount;
+		};
+
+		// The writes, and the data which they point to:
+		struct data
+		{
+			std::vector<vk::WriteDescriptorSet> mOrderedDescriptorDataWrites;
+			// The descriptor data of all bindings, in the order in which they have been stored, each one 8-byte aligned:
+			std::vector<uint64_t> mPayload;
+			std::vector<payload_entry> mPayloadEntries;
+#if VK_HEADER_VERSION >= 135
+			std::vector<std::tuple<uint32_t, vk::WriteDescriptorSetAccelerationStructureKHR>> mAccelerationStructureWrites;
+#endif
+		};
+
+		// Append the given descriptor data to the payload. The returned pointer is only valid until the next store; prepare() fixes up all of them.
+		template <typename T>
+		const T* store_payload(uint32_t aBindingId, payload_kind aKind, const T* aData, size_t aCount)
+		{
+			static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= alignof(uint64_t));
+			auto& d = mutable_data();
+			const auto offset = d.mPayload.size() * sizeof(uint64_t);
+			d.mPayload.resize(d.mPayload.size() + (aCount * sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+			auto* dst = reinterpret_cast<uint8_t*>(d.mPayload.data()) + offset;
+			if (aCount > 0) {
+				memcpy(dst, aData, aCount * sizeof(T));
+			}
+			d.mPayloadEntries.push_back(payload_entry{ aBindingId, aKind, static_cast<uint32_t>(offset), static_cast<uint32_t>(aCount) });
+			return reinterpret_cast<const T*>(dst);
+		}
+
+#if VK_HEADER_VERSION >= 135
+		const vk::WriteDescriptorSetAccelerationStructureKHR* store_acceleration_structures(uint32_t aBindingId, const vk::AccelerationStructureKHR* aHandles, size_t aCount)
+		{
+			const auto* handles = store_payload(aBindingId, payload_kind::acceleration_structures, aHandles, aCount);
+			auto& back = mutable_data().mAccelerationStructureWrites.emplace_back(aBindingId, vk::WriteDescriptorSetAccelerationStructureKHR{}
+				.setAccelerationStructureCount(static_cast<uint32_t>(aCount))
+				.setPAccelerationStructures(handles)
+			);
+			return &std::get<vk::WriteDescriptorSetAccelerationStructureKHR>(back);
+		}
+#endif
+
+		static std::optional<payload_kind> payload_kind_of(vk::DescriptorType aType);
+		static void update_data_pointers(data& aData);
+		// Get the data for modification, copying it first if it is shared with other descriptor_set instances:
+		data& mutable_data();
+
+		std::shared_ptr<data> mData;
 		std::shared_ptr<descriptor_pool> mPool;
 		vk::DescriptorSet mDescriptorSet;
 		// TODO: Are there cases where vk::UniqueDescriptorSet would be beneficial? Right now, the pool cleans up all the descriptor sets.
 		uint32_t mSetId;
-		// TODO: Probably turn all of these vectors into shared_ptrs which is much better when passing around between descriptor_cache and bind_descriptors, etc.!
-		std::vector<std::tuple<uint32_t, std::vector<vk::DescriptorImageInfo>>> mStoredImageInfos;
-		std::vector<std::tuple<uint32_t, std::vector<vk::DescriptorBufferInfo>>> mStoredBufferInfos;
-		std::vector<std::tuple<uint32_t, std::vector<vk::BufferView>>> mStoredBufferViews;
-#if VK_HEADER_VERSION >= 135
-		std::vector<std::tuple<uint32_t, std::tuple<vk::WriteDescriptorSetAccelerationStructureKHR, std::vector<vk::AccelerationStructureKHR>>>> mStoredAccelerationStructureWrites;
-#endif
+		uint64_t mContentHash = 0;
 	};
 
 	extern bool operator ==(const descriptor_set& left, const descriptor_set& right);
@@ -161,38 +222,8 @@ namespace std
 	{
 		std::size_t operator()(avk::descriptor_set const& o) const noexcept
 		{
-			std::size_t h = 0;
-			for(auto& w : o.mOrderedDescriptorDataWrites)
-			{
-				avk::hash_combine(h, w.dstBinding, w.dstArrayElement, w.descriptorCount, w.descriptorType);
-				// Dont compute a too expensive hash => only take the first elements, each:
-				if (nullptr != w.pImageInfo && w.descriptorCount > 0) {
-					avk::hash_combine(h, static_cast<VkSampler>(w.pImageInfo[0].sampler), static_cast<VkImageView>(w.pImageInfo[0].imageView), static_cast<VkImageLayout>(w.pImageInfo[0].imageLayout));
-				}
-				if (nullptr != w.pBufferInfo && w.descriptorCount > 0) {
-					avk::hash_combine(h, static_cast<VkBuffer>(w.pBufferInfo[0].buffer), w.pBufferInfo[0].offset, w.pBufferInfo[0].range);
-				}
-				if (nullptr != w.pTexelBufferView && w.descriptorCount > 0) {
-					avk::hash_combine(h, static_cast<VkBufferView>(w.pTexelBufferView[0]));
-				}
-
-#if VK_HEADER_VERSION >= 135
-				if (nullptr != w.pNext) {
-					if (w.descriptorType == vk::DescriptorType::eAccelerationStructureKHR) {
-						const auto* asInfo = reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(w.pNext);
-						avk::hash_combine(h, asInfo->accelerationStructureCount);
-						if (asInfo->accelerationStructureCount > 0) {
-							avk::hash_combine(h, static_cast<VkAccelerationStructureKHR>(asInfo->pAccelerationStructures[0]));
-						}
-					}
-					else {
-						avk::hash_combine(h, nullptr != w.pNext);
-					}
-				}
-#endif
-				// operator== will test for exact equality.
-			}
-			return h;
+			// Computed from the bindings in descriptor_set::prepare. operator== will test for exact equality.
+			return static_cast<std::size_t>(o.mContentHash);
 		}
 	};
 
@@ -30,10 +30,27 @@ namespace avk
 		const auto& required_pool_sizes() const { return mBindingRequirements; }
 		auto number_of_bindings() const { return mOrderedBindings.size(); }
 		const auto& binding_at(size_t i) const { return mOrderedBindings[i]; }
+		/** The descriptor binding flags of the binding at the given index */
+		auto binding_flags_at(size_t i) const { return mOrderedBindingFlags[i]; }
+		/** True if any of the bindings has been declared with the eUpdateAfterBind flag. Sets of such layouts must be allocated from pools created with eUpdateAfterBind. */
+		bool is_update_after_bind() const
+		{
+			return std::any_of(std::begin(mOrderedBindingFlags), std::end(mOrderedBindingFlags), [](vk::DescriptorBindingFlags aFlags) {
+				return static_cast<bool>(aFlags & vk::DescriptorBindingFlagBits::eUpdateAfterBind);
+			});
+		}
 		auto* bindings_data_ptr() const { return mOrderedBindings.data(); }
-		auto owner() const { return mLayout.getOwner(); }
-		auto has_handle() const { return static_cast<bool>(mLayout); }
-		auto handle() const { return mLayout.get(); }
+		/** Contains ePushDescriptorKHR if any binding has been marked via avk::push_descriptor (and, after allocation, if the device supports it) */
+		auto create_flags() const { return mCreateFlags; }
+		bool is_push_descriptor() const { return static_cast<bool>(mCreateFlags & vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR); }
+		auto owner() const { return mLayout->getOwner(); }
+		auto has_handle() const { return static_cast<bool>(mLayout) && static_cast<bool>(*mLayout); }
+		auto handle() const { return has_handle() ? mLayout->get() : vk::DescriptorSetLayout{}; }
+		/** The handle is shared between all identically defined layouts, see layout_registry */
+		const auto& shared_handle() const { return mLayout; }
+		auto has_update_template() const { return static_cast<bool>(mUpdateTemplate); }
+		/** The update template which writes sets of this layout from a descriptor_set's payload, see root::allocate_descriptor_update_template */
+		auto update_template_handle() const { return mUpdateTemplate.get(); }
 
 		template <typename It>
 		static descriptor_set_layout prepare(It begin, It end)
@@ -71,6 +88,10 @@ namespace avk
 				assert((it+1) == end || b.mLayoutBinding.binding != (it+1)->mLayoutBinding.binding);
 				assert((it+1) == end || b.mLayoutBinding.binding < (it+1)->mLayoutBinding.binding);
 				result.mOrderedBindings.push_back(b.mLayoutBinding);
+				result.mOrderedBindingFlags.push_back(b.mBindingFlags);
+				if (b.mPushDescriptor) {
+					result.mCreateFlags |= vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR;
+				}
 				
 				it++;
 			}
@@ -87,7 +108,10 @@ namespace avk
 	private:
 		std::vector<vk::DescriptorPoolSize> mBindingRequirements;
 		std::vector<vk::DescriptorSetLayoutBinding> mOrderedBindings;
-		vk::UniqueHandle<vk::DescriptorSetLayout, DISPATCH_LOADER_CORE_TYPE> mLayout;
+		std::vector<vk::DescriptorBindingFlags> mOrderedBindingFlags;
+		vk::DescriptorSetLayoutCreateFlags mCreateFlags;
+		std::shared_ptr<vk::UniqueHandle<vk::DescriptorSetLayout, DISPATCH_LOADER_CORE_TYPE>> mLayout;
+		vk::UniqueHandle<vk::DescriptorUpdateTemplate, DISPATCH_LOADER_CORE_TYPE> mUpdateTemplate;
 	};
 
 	extern bool operator ==(const descriptor_set_layout& left, const descriptor_set_layout& right);
@@ -101,10 +125,11 @@ namespace std
 	{
 		std::size_t operator()(avk::descriptor_set_layout const& o) const noexcept
 		{
-			std::size_t h = 0;
-			for(auto& binding : o.mOrderedBindings)
+			std::size_t h = static_cast<VkDescriptorSetLayoutCreateFlags>(o.mCreateFlags);
+			for(size_t i = 0; i < o.mOrderedBindings.size(); ++i)
 			{
-				avk::hash_combine(h, binding.binding, binding.descriptorType, binding.descriptorCount, static_cast<VkShaderStageFlags>(binding.stageFlags), binding.pImmutableSamplers);
+				const auto& binding = o.mOrderedBindings[i];
+				avk::hash_combine(h, binding.binding, binding.descriptorType, binding.descriptorCount, static_cast<VkShaderStageFlags>(binding.stageFlags), binding.pImmutableSamplers, static_cast<VkDescriptorBindingFlags>(o.mOrderedBindingFlags[i]));
 			}
 			return h;
 		}
@@ -3,10 +3,14 @@
 
 namespace avk
 {
+	class fence_pool;
+
 	/** A synchronization object which allows GPU->CPU synchronization */
 	class fence_t
 	{
 		friend class root;
+		friend class fence_pool;
+		friend class completion_dispatcher;
 		
 	public:
 		fence_t() = default;
@@ -22,19 +26,13 @@ namespace avk
 		 */
 		fence_t& set_designated_queue(queue& _Queue);
 
+		/** Set a custom deleter function, which is invoked when this fence is destroyed or reset.
+		 *	Multiple custom deleters are invoked in inverse order of addition. See also deletion_queue.
+		 */
 		template <typename F>
 		fence_t& set_custom_deleter(F&& aDeleter) noexcept
 		{
-			if (mCustomDeleter) {
-				// There is already a custom deleter! Make sure that this stays alive as well.
-				mCustomDeleter = [
-					existingDeleter = std::move(mCustomDeleter),
-					additionalDeleter = std::forward<F>(aDeleter)
-				]() {};
-			}
-			else {
-				mCustomDeleter = std::forward<F>(aDeleter);
-			}
+			mCustomDeleters.emplace_back(std::forward<F>(aDeleter));
 			return *this;
 		}
 
@@ -46,17 +44,27 @@ namespace avk
 		auto* designated_queue() const { return mQueue; }
 
 		void wait_until_signalled(std::optional<uint64_t> aTimeout = {}) const;
+		/** Query the fence's status via vkGetFenceStatus, without blocking. */
+		bool is_signalled() const;
 		void reset();
 
+		/**	Query the status of all given fences via vkGetFenceStatus, without blocking.
+		 *	@return	The indices of the fences which have been signaled, in ascending order
+		 */
+		static std::vector<size_t> poll(const std::vector<resource_reference<const fence_t>>& aFences);
+
 	private:
 		vk::FenceCreateInfo mCreateInfo;
 		vk::UniqueHandle<vk::Fence, DISPATCH_LOADER_CORE_TYPE> mFence;
-		queue* mQueue;
+		queue* mQueue = nullptr;
+		// If set, the handle is returned to this pool upon destruction instead of being destroyed.
+		// (If a fence_t is move-assigned to, its previous handle is destroyed nonetheless.)
+		std::shared_ptr<fence_pool> mPool;
 
 		// --- Some advanced features of a fence object ---
 
-		/** A custom deleter function called upon destruction of this semaphore */
-		std::optional<avk::unique_function<void()>> mCustomDeleter;
+		/** Custom deleter functions called upon destruction or reset of this fence */
+		std::vector<avk::unique_function<void()>> mCustomDeleters;
 	};
 
 	using fence = avk::owning_resource<fence_t>;
@@ -0,0 +1,55 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Recycles fences, s.t. submissions do not create and destroy a fence each.
+	 *
+	 *	Fences which are handed out by acquire() are unsignaled. When such a fence is destroyed, its
+	 *	handle is not destroyed but returned to the pool. Returned fences are checked via vkGetFenceStatus
+	 *	once the pool runs out of available ones, and all signaled ones are reset with one vkResetFences call.
+	 *	Attention: A fence which is returned unsignaled and never signaled afterwards (e.g., because it has
+	 *	never been submitted) is not reused until the pool is destroyed.
+	 *
+	 *	Every queue has a pool, from which queue::submit_with_fence takes its fences, see queue::get_fence_pool.
+	 *	The pool lives for as long as its queue or any of its fences, but it must be destroyed before the device,
+	 *	see queue::release_sync_objects.
+	 *	All functions are thread-safe.
+	 */
+	class fence_pool : public std::enable_shared_from_this<fence_pool>
+	{
+	public:
+		fence_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader);
+		fence_pool(fence_pool&&) = delete;
+		fence_pool(const fence_pool&) = delete;
+		fence_pool& operator=(fence_pool&&) = delete;
+		fence_pool& operator=(const fence_pool&) = delete;
+		~fence_pool();
+
+		/** Get an unsignaled fence, either a recycled or a newly created one. The pool must be held by a std::shared_ptr. */
+		fence acquire();
+
+		/** Check all returned fences and make the signaled ones available again. This also happens automatically in acquire(). */
+		void recycle_signalled_fences();
+
+		/** Number of fences which have been created by this pool */
+		size_t number_of_fences() const;
+		/** Number of fences which are ready to be handed out without any Vulkan calls */
+		size_t number_of_available_fences() const;
+
+	private:
+		friend class fence_t;
+
+		void give_back(vk::Fence aFence);
+		void recycle_signalled_fences_locked();
+
+		vk::Device mDevice;
+		const DISPATCH_LOADER_CORE_TYPE* mDispatchLoader;
+		mutable std::mutex mMutex;
+		size_t mNumberOfFences = 0;
+		// Fences which have been reset and can be handed out:
+		std::vector<vk::Fence> mAvailable;
+		// Fences which have been returned, but might still be pending:
+		std::vector<vk::Fence> mReturned;
+	};
+}
@@ -63,10 +63,41 @@ namespace avk
 		const auto& layout_create_info() const { return mPipelineLayoutCreateInfo; }
 		const auto& tessellation_state_create_info() const { return mPipelineTessellationStateCreateInfo; }
 		const auto& create_flags() const { return mPipelineCreateFlags; }
-		const auto& layout_handle() const { return mPipelineLayout.get(); }
+		vk::PipelineLayout layout_handle() const { return mPipelineLayout ? mPipelineLayout->handle() : vk::PipelineLayout{}; }
+		/** The pipeline layout, which is shared with all pipelines that have identical resource bindings and push constants */
+		const auto& shared_layout() const { return mPipelineLayout; }
 		std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> layout() const { return std::make_tuple(this, layout_handle(), &mPushConstantRanges); }
 		const auto& handle() const { return mPipeline.get(); }
-		
+		/** Timing and cache information gathered during the most recent creation of this pipeline */
+		const auto& creation_feedback() const { return mCreationFeedback; }
+
+#if VK_HEADER_VERSION >= 213
+		/** The cache this pipeline's libraries have been taken from, or nullptr if it has been created monolithically */
+		auto* pipeline_library_cache() const { return mPipelineLibraryCache; }
+		/** True if a link-time optimized version of this pipeline is being created in the background */
+		bool has_pending_optimized_pipeline() const { return mOptimizedPipelineJob.valid(); }
+
+		/**	If the link-time optimized version of this pipeline has been created in the background,
+		 *	replace the fast-linked pipeline handle with it.
+		 *	@param	aLifetimeHandler	Receives the fast-linked pipeline handle, which might still be in use
+		 *								by command buffers in flight. Keep it alive until they have completed.
+		 *	@return	True if the optimized pipeline has been swapped in, false if it is not ready (yet).
+		 */
+		template <typename F>
+		bool update_to_optimized_pipeline(F&& aLifetimeHandler)
+		{
+			if (!mOptimizedPipelineJob.valid() || std::future_status::ready != mOptimizedPipelineJob.wait_for(std::chrono::seconds(0))) {
+				return false;
+			}
+			auto optimized = mOptimizedPipelineJob.get();
+			if (!optimized) {
+				return false;
+			}
+			assign_and_lifetime_handle_previous(mPipeline, std::move(optimized), std::forward<F>(aLifetimeHandler));
+			return true;
+		}
+#endif
+
 	private:
 		renderpass mRenderPass;
 		uint32_t mSubpassIndex;
@@ -105,9 +136,23 @@ namespace avk
 		// TODO: What to do with flags?
 		vk::PipelineCreateFlags mPipelineCreateFlags;
 
+		// Gathered during creation:
+		pipeline_creation_feedback mCreationFeedback;
+
+#if VK_HEADER_VERSION >= 213
+		// If set, the pipeline is fast-linked from the libraries in this cache:
+		graphics_pipeline_library_cache* mPipelineLibraryCache = nullptr;
+#endif
+
 		// Handles:
-		vk::UniqueHandle<vk::PipelineLayout, DISPATCH_LOADER_CORE_TYPE> mPipelineLayout;
+		std::shared_ptr<const shared_pipeline_layout> mPipelineLayout;
 		vk::UniqueHandle<vk::Pipeline, DISPATCH_LOADER_CORE_TYPE> mPipeline;
+
+#if VK_HEADER_VERSION >= 213
+		// Background job creating the link-time optimized pipeline. Declared after the pipeline
+		// layout, so that its destructor waits for the job before the layout is destroyed.
+		std::future<vk::UniqueHandle<vk::Pipeline, DISPATCH_LOADER_CORE_TYPE>> mOptimizedPipelineJob;
+#endif
 	};
 	
 	using graphics_pipeline = avk::owning_resource<graphics_pipeline_t>;
@@ -116,13 +161,33 @@ namespace avk
 	inline void command_buffer_t::bind_pipeline<resource_reference<const graphics_pipeline_t>>(resource_reference<const graphics_pipeline_t> aPipelineRef)
 	{
 		handle().bindPipeline(vk::PipelineBindPoint::eGraphics, aPipelineRef->handle());
+#if VK_HEADER_VERSION >= 204
+		// States which are baked into the pipeline overwrite previously set dynamic state values:
+		invalidate_dynamic_states_not_in(aPipelineRef->dynamic_state_entries());
+#endif
 	}
 
 	template <>
 	inline void command_buffer_t::bind_descriptors<std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*>>
 		(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets)
 	{
-		bind_descriptors(vk::PipelineBindPoint::eGraphics, std::get<const graphics_pipeline_t*>(aPipelineLayout)->layout_handle(), std::move(aDescriptorSets));
+		bind_descriptors(vk::PipelineBindPoint::eGraphics, std::get<const graphics_pipeline_t*>(aPipelineLayout)->shared_layout(), std::move(aDescriptorSets));
+	}
+
+	template <>
+	inline void command_buffer_t::push_descriptors<std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*>>
+		(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::initializer_list<binding_data> aBindings, descriptor_cache& aFallbackCache, const root& aRoot)
+	{
+		push_descriptors(vk::PipelineBindPoint::eGraphics, std::get<const graphics_pipeline_t*>(aPipelineLayout)->shared_layout(), aBindings, aFallbackCache, aRoot);
+	}
+
+#if VK_HEADER_VERSION >= 235
+	template <>
+	inline void command_buffer_t::bind_descriptors<std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*>>
+		(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::initializer_list<binding_data> aBindings, descriptor_buffer& aDescriptorBuffer)
+	{
+		bind_descriptors(vk::PipelineBindPoint::eGraphics, std::get<const graphics_pipeline_t*>(aPipelineLayout)->shared_layout(), aBindings, aDescriptorBuffer);
 	}
+#endif
 
 }
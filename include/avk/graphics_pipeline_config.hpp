@@ -12,7 +12,9 @@ namespace avk
 			force_new_pipe			= 0x0001,
 			fail_if_not_reusable	= 0x0002,
 			disable_optimization	= 0x0004,
-			allow_derivatives		= 0x0008
+			allow_derivatives		= 0x0008,
+			/** Create the pipeline and its descriptor set layouts for VK_EXT_descriptor_buffer, see avk::descriptor_buffer */
+			descriptor_buffer		= 0x0010
 		};
 
 		inline pipeline_settings operator| (pipeline_settings a, pipeline_settings b)
@@ -298,6 +300,68 @@ namespace avk
 			VkStencilOpState mBackStencilTestActions;
 		};
 
+#if VK_HEADER_VERSION >= 204
+		/**	Pipeline configuration data: Which states shall not be baked into the pipeline, but be set
+		 *	via the respective command_buffer_t::set_* methods while recording instead.
+		 *	The static values in the pipeline config are ignored for all states that are declared dynamic.
+		 *	This way, pipelines which would only differ in these states can be collapsed into one.
+		 *
+		 *	Requirements:
+		 *	 - cull_mode through stencil_operation: VK_EXT_extended_dynamic_state or Vulkan 1.3
+		 *	 - rasterizer_discard through primitive_restart: VK_EXT_extended_dynamic_state2 or Vulkan 1.3
+		 *	 - polygon_mode through color_write_mask: VK_EXT_extended_dynamic_state3 and the respective features
+		 *	Note: Unless dynamicPrimitiveTopologyUnrestricted is supported, a dynamic primitive_topology
+		 *	      must remain within the topology class (points, lines, triangles, patches) of the pipeline config.
+		 */
+		enum struct dynamic_state
+		{
+			none						= 0x00000,
+			cull_mode					= 0x00001,
+			front_face					= 0x00002,
+			primitive_topology			= 0x00004,
+			depth_test					= 0x00008,
+			depth_write					= 0x00010,
+			depth_compare_operation		= 0x00020,
+			depth_bounds_test			= 0x00040,
+			stencil_test				= 0x00080,
+			stencil_operation			= 0x00100,
+			rasterizer_discard			= 0x00200,
+			depth_bias					= 0x00400,
+			primitive_restart			= 0x00800,
+#if VK_HEADER_VERSION >= 233
+			polygon_mode				= 0x01000,
+			depth_clamp					= 0x02000,
+			color_blend_enable			= 0x04000,
+			color_write_mask			= 0x08000,
+#endif
+			culling						= cull_mode | front_face,
+			depth						= depth_test | depth_write | depth_compare_operation,
+			stencil						= stencil_test | stencil_operation
+		};
+
+		inline dynamic_state operator| (dynamic_state a, dynamic_state b)
+		{
+			typedef std::underlying_type<dynamic_state>::type EnumType;
+			return static_cast<dynamic_state>(static_cast<EnumType>(a) | static_cast<EnumType>(b));
+		}
+
+		inline dynamic_state operator& (dynamic_state a, dynamic_state b)
+		{
+			typedef std::underlying_type<dynamic_state>::type EnumType;
+			return static_cast<dynamic_state>(static_cast<EnumType>(a) & static_cast<EnumType>(b));
+		}
+
+		inline dynamic_state& operator |= (dynamic_state& a, dynamic_state b)
+		{
+			return a = a | b;
+		}
+
+		inline dynamic_state& operator &= (dynamic_state& a, dynamic_state b)
+		{
+			return a = a & b;
+		}
+#endif
+
 		/** Reference the separate color channels */
 		enum struct color_channel
 		{
@@ -621,6 +685,12 @@ namespace avk
 		std::optional<cfg::tessellation_patch_control_points> mTessellationPatchControlPoints;
 		std::optional<cfg::per_sample_shading_config> mPerSampleShading;
 		std::optional<cfg::stencil_test> mStencilTest;
+#if VK_HEADER_VERSION >= 204
+		cfg::dynamic_state mDynamicStates;
+#endif
+#if VK_HEADER_VERSION >= 213
+		std::optional<cfg::pipeline_library_cache_usage> mPipelineLibraryCache;
+#endif
 	};
 
 	// End of recursive variadic template handling
@@ -802,6 +872,26 @@ namespace avk
 		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
 	}
 
+#if VK_HEADER_VERSION >= 204
+	// Declare states to be set dynamically while recording
+	template <typename... Ts>
+	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, cfg::dynamic_state aDynamicStates, Ts... args)
+	{
+		aConfig.mDynamicStates |= aDynamicStates;
+		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
+	}
+#endif
+
+#if VK_HEADER_VERSION >= 213
+	// Create the pipeline from cached pipeline libraries
+	template <typename... Ts>
+	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, cfg::pipeline_library_cache_usage aPipelineLibraryCache, Ts... args)
+	{
+		aConfig.mPipelineLibraryCache = aPipelineLibraryCache;
+		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
+	}
+#endif
+
 	// Add a resource binding to the pipeline config
 	template <typename... Ts>
 	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, binding_data aResourceBinding, Ts... args)
@@ -0,0 +1,105 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+#if VK_HEADER_VERSION >= 213
+	/**	A cache for graphics pipeline libraries (VK_EXT_graphics_pipeline_library).
+	 *
+	 *	Graphics pipelines which are created with this cache (see cfg::use_pipeline_library_cache)
+	 *	are not compiled monolithically. Instead, they are split into the four parts
+	 *	 - vertex input interface,
+	 *	 - pre-rasterization shaders,
+	 *	 - fragment shader, and
+	 *	 - fragment output interface,
+	 *	each of which is created as a separate pipeline library and cached by the part of
+	 *	the pipeline config that is relevant for it. Cached libraries are looked up by a hash
+	 *	over that sub-config, and only reused if the sub-config matches exactly. The final pipeline is then
+	 *	fast-linked from the four libraries, which is much cheaper than a full compilation
+	 *	whenever some of the parts are already contained in the cache.
+	 *
+	 *	Optionally, a link-time optimized version of each pipeline can be created in the
+	 *	background (see enable_background_optimization). Use
+	 *	graphics_pipeline_t::update_to_optimized_pipeline to switch to it once it is ready.
+	 *
+	 *	Requirements: The device extension VK_EXT_graphics_pipeline_library (and VK_KHR_pipeline_library)
+	 *	must be enabled, and the graphicsPipelineLibrary feature must be supported and enabled.
+	 *
+	 *	Attention: The cache must outlive all pipelines which have been linked from its libraries.
+	 *	           It is not thread-safe, i.e. pipelines must not be created with the same cache
+	 *	           from multiple threads concurrently. (Background optimization jobs do not
+	 *	           access the cache.)
+	 */
+	class graphics_pipeline_library_cache
+	{
+		friend class root;
+
+	public:
+		/** The different parts of a graphics pipeline which are created as separate libraries */
+		enum struct part : uint32_t
+		{
+			vertex_input_interface,
+			pre_rasterization_shaders,
+			fragment_shader,
+			fragment_output_interface
+		};
+
+		graphics_pipeline_library_cache() = default;
+		graphics_pipeline_library_cache(graphics_pipeline_library_cache&&) noexcept = default;
+		graphics_pipeline_library_cache(const graphics_pipeline_library_cache&) = delete;
+		graphics_pipeline_library_cache& operator=(graphics_pipeline_library_cache&&) noexcept = default;
+		graphics_pipeline_library_cache& operator=(const graphics_pipeline_library_cache&) = delete;
+		~graphics_pipeline_library_cache() = default;
+
+		/**	Enable or disable creating link-time optimized pipelines in the background
+		 *	for all pipelines which are fast-linked from this cache from now on.
+		 */
+		void enable_background_optimization(bool aEnable = true) { mBackgroundOptimization = aEnable; }
+		auto is_background_optimization_enabled() const { return mBackgroundOptimization; }
+
+		auto number_of_libraries() const { return mLibraries.size(); }
+		auto number_of_cache_hits() const { return mCacheHits; }
+		auto number_of_cache_misses() const { return mCacheMisses; }
+
+		/** Destroy all libraries. Attention: Pipelines linked from them must not be in use anymore. */
+		void cleanup();
+
+	private:
+		// A library, together with the part and the exact sub-config which it has been created for:
+		struct library
+		{
+			part mPart;
+			std::string mSubConfig;
+			vk::UniqueHandle<vk::Pipeline, DISPATCH_LOADER_CORE_TYPE> mHandle;
+		};
+
+		static size_t key_for(part aPart, std::string_view aSubConfig);
+		// The library for the given part and sub-config, or nullptr if it is not contained in the cache:
+		const library* find(part aPart, std::string_view aSubConfig) const;
+
+		const root* mRoot = nullptr;
+		bool mBackgroundOptimization = false;
+		uint64_t mCacheHits = 0;
+		uint64_t mCacheMisses = 0;
+		// Keyed by key_for; entries with the same key are told apart by their sub-configs:
+		std::unordered_multimap<size_t, library> mLibraries;
+	};
+
+	namespace cfg
+	{
+		/** Pipeline configuration data: Create the pipeline from (cached) pipeline libraries */
+		struct pipeline_library_cache_usage
+		{
+			graphics_pipeline_library_cache* mCache;
+		};
+
+		/**	Indicate that a graphics pipeline shall be fast-linked from pipeline libraries,
+		 *	which are taken from (or added to) the given cache.
+		 */
+		inline pipeline_library_cache_usage use_pipeline_library_cache(graphics_pipeline_library_cache& aCache)
+		{
+			return pipeline_library_cache_usage{ &aCache };
+		}
+	}
+#endif
+}
@@ -23,7 +23,7 @@ namespace avk
 		auto view_handle() const				{ return mImageView->handle(); }
 		auto image_handle() const					{ return mImageView->get_image().handle(); }
 		auto sampler_handle() const				{ return mSampler->handle(); }
-		auto descriptor_info() const		{ return mDescriptorInfo; }
+		const auto& descriptor_info() const		{ return mDescriptorInfo; }
 		auto descriptor_type() const		{ return mDescriptorType; }
 		/** Gets the width of the image */
 		uint32_t width() const { return mImageView->get_image().width(); }
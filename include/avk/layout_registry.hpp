@@ -0,0 +1,110 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	A pipeline layout which is shared between all pipelines that have been created with identical
+	 *	descriptor set layouts, push constant ranges, and flags. Instances are handed out by layout_registry.
+	 */
+	class shared_pipeline_layout
+	{
+		friend class layout_registry;
+
+	public:
+		shared_pipeline_layout() = default;
+		shared_pipeline_layout(shared_pipeline_layout&&) noexcept = default;
+		shared_pipeline_layout(const shared_pipeline_layout&) = delete;
+		shared_pipeline_layout& operator=(shared_pipeline_layout&&) noexcept = default;
+		shared_pipeline_layout& operator=(const shared_pipeline_layout&) = delete;
+		~shared_pipeline_layout() = default;
+
+		auto handle() const { return mPipelineLayout.get(); }
+		auto flags() const { return mFlags; }
+		/** The create flags of each set's descriptor set layout, indexed by set-id */
+		const auto& set_layout_create_flags() const { return mSetLayoutCreateFlags; }
+		/** True if the set with the given id has been declared for push descriptors, see command_buffer_t::push_descriptors */
+		bool is_push_descriptor_set(uint32_t aSetId) const { return aSetId < mSetLayoutCreateFlags.size() && static_cast<bool>(mSetLayoutCreateFlags[aSetId] & vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR); }
+		const auto& set_layout_handles() const { return mSetLayoutHandles; }
+		/** The descriptor set layouts, indexed by set-id. They are kept alive for as long as this layout exists. */
+		const auto& set_layouts() const { return mSetLayouts; }
+		const auto& push_constant_ranges() const { return mPushConstantRanges; }
+
+		/** A create info which describes this layout. It points into this instance's data. */
+		vk::PipelineLayoutCreateInfo create_info() const;
+
+		/**	Get the number of sets, counted from set 0, for which this layout is compatible with the
+		 *	other one according to Vulkan's pipeline layout compatibility rules. Descriptor sets which
+		 *	have been bound via one of the two layouts at these set numbers remain valid for the other.
+		 */
+		uint32_t number_of_compatible_sets(const shared_pipeline_layout& aOther) const;
+
+	private:
+		vk::PipelineLayoutCreateFlags mFlags;
+		std::vector<vk::DescriptorSetLayout> mSetLayoutHandles;
+		std::vector<vk::DescriptorSetLayoutCreateFlags> mSetLayoutCreateFlags;
+		std::vector<vk::PushConstantRange> mPushConstantRanges;
+		// Keep the descriptor set layouts alive for as long as this layout exists:
+		std::vector<std::shared_ptr<vk::UniqueHandle<vk::DescriptorSetLayout, DISPATCH_LOADER_CORE_TYPE>>> mSetLayouts;
+		vk::UniqueHandle<vk::PipelineLayout, DISPATCH_LOADER_CORE_TYPE> mPipelineLayout;
+	};
+
+	/**	Deduplicates descriptor set layouts and pipeline layouts: Identically defined layouts are only
+	 *	created once per device and are shared between all pipelines and descriptor caches which use them.
+	 *	Pipelines with identical resource bindings thereby get identical layout handles, which makes them
+	 *	layout-compatible, s.t. command buffers can skip rebinding descriptor sets across pipeline switches.
+	 *
+	 *	The registry does not own the layouts. Each one is destroyed as soon as the last pipeline,
+	 *	descriptor cache, or command buffer which refers to it releases it.
+	 *	There is one registry per process, accessible via root::global_layout_registry. It is thread-safe.
+	 */
+	class layout_registry
+	{
+	public:
+		using descriptor_set_layout_handle = std::shared_ptr<vk::UniqueHandle<vk::DescriptorSetLayout, DISPATCH_LOADER_CORE_TYPE>>;
+
+		layout_registry() = default;
+		layout_registry(layout_registry&&) = delete;
+		layout_registry(const layout_registry&) = delete;
+		layout_registry& operator=(layout_registry&&) = delete;
+		layout_registry& operator=(const layout_registry&) = delete;
+		~layout_registry() = default;
+
+		/**	Get the descriptor set layout for the given bindings, creating it if no identical one exists.
+		 *	@param	aOrderedBindings		The bindings, ordered by binding index
+		 *	@param	aOrderedBindingFlags	Either empty, or one set of descriptor binding flags per binding. If any binding
+		 *									has eUpdateAfterBind, the layout is created with eUpdateAfterBindPool.
+		 *	@param	aFlags					Additional create flags, like ePushDescriptorKHR
+		 */
+		descriptor_set_layout_handle get_or_create_descriptor_set_layout(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorSetLayoutBinding>& aOrderedBindings, const std::vector<vk::DescriptorBindingFlags>& aOrderedBindingFlags = {}, vk::DescriptorSetLayoutCreateFlags aFlags = {});
+
+		/**	Get the pipeline layout for the given (already allocated) descriptor set layouts and push constant
+		 *	ranges, creating it if no identical one exists.
+		 */
+		std::shared_ptr<const shared_pipeline_layout> get_or_create_pipeline_layout(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const set_of_descriptor_set_layouts& aSetLayouts, const std::vector<vk::PushConstantRange>& aPushConstantRanges, vk::PipelineLayoutCreateFlags aFlags = {});
+
+		/** Number of descriptor set layouts which are currently alive */
+		size_t number_of_descriptor_set_layouts() const;
+		/** Number of pipeline layouts which are currently alive */
+		size_t number_of_pipeline_layouts() const;
+		/** How often an existing layout has been returned instead of creating a new one */
+		uint64_t number_of_reuses() const { return mNumberOfReuses; }
+
+		/** Remove the entries of layouts which have already been destroyed. This also happens automatically from time to time. */
+		void remove_expired_entries();
+
+	private:
+		// Keys are the layouts' definitions (including the device), serialized into 64-bit words:
+		struct key_hash
+		{
+			size_t operator()(const std::vector<uint64_t>& aKey) const;
+		};
+
+		void remove_expired_entries_locked();
+
+		mutable std::mutex mMutex;
+		std::unordered_map<std::vector<uint64_t>, std::weak_ptr<vk::UniqueHandle<vk::DescriptorSetLayout, DISPATCH_LOADER_CORE_TYPE>>, key_hash> mDescriptorSetLayouts;
+		std::unordered_map<std::vector<uint64_t>, std::weak_ptr<const shared_pipeline_layout>, key_hash> mPipelineLayouts;
+		std::atomic<uint64_t> mNumberOfReuses{ 0 };
+		size_t mInsertionsSinceCleanup = 0;
+	};
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Timing and cache information about the creation of one pipeline.
+	 *
+	 *	The CPU wall times are always measured. The driver-side information is only available if
+	 *	driver feedback has been enabled via pipeline_creation_statistics::enable_driver_feedback
+	 *	and the driver has actually provided it (see mDriverFeedbackValid).
+	 */
+	struct pipeline_creation_feedback
+	{
+		/** Driver feedback for one shader stage, in the order of the pipeline's shader stage create infos */
+		struct stage_feedback
+		{
+			shader_type mShaderType;
+			bool mValid;
+			bool mApplicationPipelineCacheHit;
+			std::chrono::nanoseconds mDuration;
+		};
+
+		/** Identifies the pipeline in reports: its type and the paths of its shaders */
+		std::string mDescription;
+
+		/** CPU wall time spent loading shaders and creating shader modules */
+		std::chrono::nanoseconds mShaderLoadDuration{ 0 };
+		/** CPU wall time spent creating descriptor set layouts and the pipeline layout */
+		std::chrono::nanoseconds mLayoutCreationDuration{ 0 };
+		/** CPU wall time spent in vkCreate*Pipelines (including the creation of libraries, if any) */
+		std::chrono::nanoseconds mPipelineCreationDuration{ 0 };
+
+		/** True if the driver has provided valid feedback for the whole pipeline */
+		bool mDriverFeedbackValid = false;
+		/** True if the pipeline has been found in the pipeline cache without compiling it */
+		bool mApplicationPipelineCacheHit = false;
+		/** True if a base pipeline has been used to accelerate the creation */
+		bool mBasePipelineAcceleration = false;
+		/** Duration of the pipeline creation as reported by the driver */
+		std::chrono::nanoseconds mDriverDuration{ 0 };
+		std::vector<stage_feedback> mStages;
+
+		std::chrono::nanoseconds total_duration() const { return mShaderLoadDuration + mLayoutCreationDuration + mPipelineCreationDuration; }
+	};
+
+	/** Aggregated pipeline creation feedback, as returned by pipeline_creation_statistics::report */
+	struct pipeline_creation_report
+	{
+		/** Fraction of pipelines with valid driver feedback which have been cache hits */
+		double cache_hit_rate() const { return 0 == mNumberOfPipelinesWithDriverFeedback ? 0.0 : static_cast<double>(mNumberOfCacheHits) / static_cast<double>(mNumberOfPipelinesWithDriverFeedback); }
+
+		/** Multi-line, human readable summary, suitable for logs */
+		std::string to_string() const;
+
+		uint64_t mNumberOfPipelines = 0;
+		uint64_t mNumberOfPipelinesWithDriverFeedback = 0;
+		uint64_t mNumberOfCacheHits = 0;
+		std::chrono::nanoseconds mTotalShaderLoadDuration{ 0 };
+		std::chrono::nanoseconds mTotalLayoutCreationDuration{ 0 };
+		std::chrono::nanoseconds mTotalPipelineCreationDuration{ 0 };
+		std::chrono::nanoseconds mMaxPipelineCreationDuration{ 0 };
+		/** The pipelines which took the longest to create, in descending order of their total durations */
+		std::vector<pipeline_creation_feedback> mSlowestPipelines;
+	};
+
+	/**	Process-wide statistics about all pipelines which have been created via root.
+	 *	All functions are thread-safe.
+	 */
+	class pipeline_creation_statistics
+	{
+	public:
+		/**	Chain VkPipelineCreationFeedbackCreateInfoEXT into all subsequent pipeline creations.
+		 *	Requirements: VK_EXT_pipeline_creation_feedback must be enabled, or the device must support Vulkan 1.3.
+		 */
+		static void enable_driver_feedback(bool aEnable = true);
+		static bool is_driver_feedback_enabled();
+
+		/** Add the feedback of one pipeline to the statistics. This is invoked by root for every pipeline it creates. */
+		static void record(const pipeline_creation_feedback& aFeedback);
+
+		/**	Get the aggregated statistics of all pipelines recorded since the last reset.
+		 *	@param	aNumberOfSlowest	How many of the slowest pipelines to include (at most 32 are being tracked)
+		 */
+		static pipeline_creation_report report(size_t aNumberOfSlowest = 10);
+
+		static void reset();
+	};
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	One axis of a specialization constant permutation: All the values which one
+	 *	specialization constant shall take across the variants of a pipeline.
+	 *	Create instances via specialization_constant_values.
+	 */
+	struct specialization_constant_axis
+	{
+		size_t num_values() const { return mValues.size() / mValueSize; }
+		const uint8_t* value_at(size_t aIndex) const { return mValues.data() + aIndex * mValueSize; }
+
+		uint32_t mConstantId;
+		/** The shaders this constant is set for (can be a combination of multiple shader types) */
+		shader_type mShaderTypes;
+		size_t mValueSize;
+		size_t mValueAlignment;
+		/** All values, tightly packed, mValueSize bytes each */
+		std::vector<uint8_t> mValues;
+	};
+
+	/**	Describe one axis of a specialization constant permutation.
+	 *	@param	aConstantId		The ID of the specialization constant
+	 *	@param	aValues			All the values it shall take. Pay attention to specify the correct type!
+	 *	@param	aShaderTypes	The shaders the constant shall be set for
+	 *	Example usage:
+	 *	  specialization_constant_values(0u, std::vector<uint32_t>{ 1u, 2u, 4u }), // quality levels
+	 *	  specialization_constant_values(1u, std::vector<vk::Bool32>{ VK_FALSE, VK_TRUE }, shader_type::fragment) // feature toggle
+	 */
+	template <typename T>
+	specialization_constant_axis specialization_constant_values(uint32_t aConstantId, const std::vector<T>& aValues, shader_type aShaderTypes = shader_type::all)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		static_assert(!std::is_same_v<T, bool>, "Boolean specialization constants are 32 bits wide => use vk::Bool32 values.");
+		if (aValues.empty()) {
+			throw avk::runtime_error("A specialization constant axis must contain at least one value.");
+		}
+		specialization_constant_axis result{ aConstantId, aShaderTypes, sizeof(T), alignof(T), std::vector<uint8_t>(aValues.size() * sizeof(T)) };
+		memcpy(result.mValues.data(), aValues.data(), result.mValues.size());
+		return result;
+	}
+
+	/**	All variants of a pipeline which result from the cross product of a set of specialization
+	 *	constant axes, stored in one table which is indexed by a packed key.
+	 *	The key of a variant is formed from the indices into the axes' values (mixed radix, the last
+	 *	axis varying fastest), i.e. looking up a variant is a simple array access.
+	 *	Create instances via root::create_graphics_pipeline_variants or root::create_compute_pipeline_variants.
+	 *	@tparam	P	The owning pipeline type, i.e. graphics_pipeline or compute_pipeline
+	 */
+	template <typename P>
+	class pipeline_variants
+	{
+		friend class root;
+
+	public:
+		pipeline_variants() = default;
+		pipeline_variants(pipeline_variants&&) noexcept = default;
+		pipeline_variants(const pipeline_variants&) = delete;
+		pipeline_variants& operator=(pipeline_variants&&) noexcept = default;
+		pipeline_variants& operator=(const pipeline_variants&) = delete;
+		~pipeline_variants() = default;
+
+		auto number_of_variants() const { return mVariants.size(); }
+		auto number_of_axes() const { return mAxisSizes.size(); }
+		/** Number of values of each axis, in the order of the axes passed at creation */
+		const auto& axis_sizes() const { return mAxisSizes; }
+
+		/**	Pack the given value indices into a variant key.
+		 *	@param	aValueIndices	One index into each axis' values, in the order of the axes passed at creation
+		 */
+		size_t key_for(std::initializer_list<size_t> aValueIndices) const
+		{
+			assert(aValueIndices.size() == mAxisSizes.size());
+			size_t key = 0;
+			size_t i = 0;
+			for (auto index : aValueIndices) {
+				assert(index < mAxisSizes[i]);
+				key += index * mStrides[i++];
+			}
+			return key;
+		}
+
+		/** Get the variant with the given packed key */
+		const P& at(size_t aKey) const { return mVariants[aKey]; }
+		P& at(size_t aKey) { return mVariants[aKey]; }
+
+		/** Get the variant for the given value indices, one per axis */
+		const P& get(std::initializer_list<size_t> aValueIndices) const { return mVariants[key_for(aValueIndices)]; }
+		P& get(std::initializer_list<size_t> aValueIndices) { return mVariants[key_for(aValueIndices)]; }
+
+		auto begin() { return mVariants.begin(); }
+		auto end() { return mVariants.end(); }
+		auto begin() const { return mVariants.begin(); }
+		auto end() const { return mVariants.end(); }
+
+	private:
+		std::vector<size_t> mAxisSizes;
+		std::vector<size_t> mStrides;
+		std::vector<P> mVariants;
+	};
+}
@@ -5,6 +5,7 @@ namespace avk
 {
 	// Forward declare:
 	struct queue_submit_proxy;
+	class completion_dispatcher;
 
 	enum struct queue_selection_preference
 	{
@@ -27,6 +28,11 @@ namespace avk
 	*/
 	class queue
 	{
+#if VK_HEADER_VERSION >= 135
+		friend struct completion_token;
+		friend class submission_service;
+#endif
+
 	public:
 		queue() = default;
 		queue(const queue&) = delete;
@@ -136,6 +142,14 @@ namespace avk
 		auto priority() const { return mPriority; }
 		const auto& handle() const { return mQueue; }
 		const auto* handle_ptr() const { return &mQueue; }
+		/** The pool which submit_with_fence takes its fences from. It is created on first use. */
+		fence_pool& get_fence_pool() const;
+
+		/**	Destroy the queue's fence pool and timeline semaphore. Call it before the device is destroyed, once all
+		 *	submissions to this queue have completed and all fences from its pool have been destroyed (they keep the pool alive).
+		 *	Both are created anew if the queue is used afterwards.
+		 */
+		void release_sync_objects();
 
 		/** TODO */
 		void submit_with_semaphore(resource_reference<semaphore_t> aSemaphoreToSignal, resource_reference<command_buffer_t> aCommandBuffer, std::optional<resource_reference<semaphore_t>> aWaitSemaphores = {});
@@ -165,6 +179,27 @@ namespace avk
 		/** TODO */
 		semaphore submit_and_handle_with_semaphore(std::vector<resource_ownership<command_buffer_t>> aCommandBuffers, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores = {});
 
+#if VK_HEADER_VERSION >= 135
+		/**	Submit the given command buffers and let them signal the next value of this queue's timeline semaphore.
+		 *	No semaphore or fence is created per submission. Requires the timelineSemaphore feature.
+		 *	@param	aCommandBuffers		The command buffers to submit. Their post-execution handlers are invoked as with submit.
+		 *	@param	aWaitFor			Submissions, to this or to other queues, which must have completed before the command buffers
+		 *								execute. They are waited on via their timeline values; per queue, only the highest value is waited on.
+		 *	@param	aWaitStage			The stages of the command buffers which must wait for aWaitFor
+		 *	@param	aCompletionDispatcher	If set, the completion handlers of the command buffers are registered with it,
+		 *								s.t. they are invoked once the returned token has completed.
+		 *	@return	The token which refers to the completion of the command buffers
+		 */
+		completion_token submit_with_completion_token(std::vector<resource_reference<command_buffer_t>> aCommandBuffers, std::vector<completion_token> aWaitFor = {}, vk::PipelineStageFlags aWaitStage = vk::PipelineStageFlagBits::eAllCommands, completion_dispatcher* aCompletionDispatcher = nullptr);
+
+		/** The value which the latest submission via submit_with_completion_token is going to signal */
+		uint64_t last_submitted_value() const { return mTimelineValue; }
+		/** The value which the timeline semaphore has reached, i.e., all submissions up to it have completed */
+		uint64_t completed_value() const;
+		/** The queue's timeline semaphore, or a null handle if nothing has been submitted via submit_with_completion_token yet */
+		vk::Semaphore timeline_semaphore() const { return mTimelineSemaphore.get(); }
+#endif
+
 		bool is_prepared() const { return static_cast<bool>(mPhysicalDevice); }
 		
 	private:
@@ -175,6 +210,17 @@ namespace avk
 		vk::Device mDevice;
 		vk::Queue mQueue;
 		const DISPATCH_LOADER_CORE_TYPE* mDispatchLoader;
+		// Created on first use, s.t. queues which never hand out fences do not hold any Vulkan objects:
+		mutable std::shared_ptr<fence_pool> mFencePool;
+#if VK_HEADER_VERSION >= 135
+		// Appends the timeline semaphores and values to wait on for the given tokens; per queue, only the highest value:
+		static void gather_timeline_waits(const std::vector<completion_token>& aTokens, std::vector<vk::Semaphore>& aSemaphores, std::vector<uint64_t>& aValues);
+		vk::Semaphore get_or_create_timeline_semaphore();
+
+		// Created on the first submission with a completion token:
+		vk::UniqueHandle<vk::Semaphore, DISPATCH_LOADER_CORE_TYPE> mTimelineSemaphore;
+		uint64_t mTimelineValue = 0;
+#endif
 	};
 
 	static bool operator==(const queue& left, const queue& right)
@@ -55,6 +55,7 @@ namespace avk
 			
 			aOther.mMemHandle = nullptr;
 			aOther.mMappedMemory = nullptr;
+			return *this;
 		}
 
 		/**	Get the memory address of the mapped memory.
@@ -26,23 +26,12 @@ namespace avk
 
 		/** Set a custom deleter function.
 		 *	This is often used for resource cleanup, e.g. a buffer which can be deleted when this semaphore is destroyed.
+		 *	Multiple custom deleters are invoked in inverse order of addition. See also deletion_queue.
 		 */
 		template <typename F>
 		semaphore_t& set_custom_deleter(F&& aDeleter) noexcept
 		{
-			if (mCustomDeleter.has_value()) {
-				// There is already a custom deleter! Make sure that this stays alive as well.
-				mCustomDeleter = [
-					existingDeleter = std::move(mCustomDeleter.value()),
-					additionalDeleter = std::forward<F>(aDeleter)
-				]() {
-					additionalDeleter();
-					existingDeleter();
-				};
-			}
-			else {
-				mCustomDeleter = std::forward<F>(aDeleter);
-			}
+			mCustomDeleters.emplace_back(std::forward<F>(aDeleter));
 			return *this;
 		}
 
@@ -66,8 +55,8 @@ namespace avk
 		// Info for the next command, at which stage the semaphore wait should occur.
 		vk::PipelineStageFlags mSemaphoreWaitStageForNextCommand;
 
-		/** A custom deleter function called upon destruction of this semaphore */
-		std::optional<avk::unique_function<void()>> mCustomDeleter;
+		/** Custom deleter functions called upon destruction of this semaphore */
+		std::vector<avk::unique_function<void()>> mCustomDeleters;
 	};
 
 	// Typedef for a variable representing an owner of a semaphore
@@ -0,0 +1,75 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	A read-only, memory-mapped archive of SPIR-V shader binaries.
+	 *
+	 *	Archives are created with the avk_shader_archive_packer tool. The whole file is
+	 *	mapped into memory once, and the SPIR-V code of the contained shaders is handed
+	 *	out as spans pointing directly into the mapping, i.e. without any copies.
+	 *
+	 *	Archives can be mounted globally via shader_archive::mount. root::create_shader
+	 *	looks up the paths of all shader_info instances in the mounted archives first,
+	 *	before trying to load the shaders from individual files.
+	 */
+	class shader_archive
+	{
+	public:
+		shader_archive() = default;
+		shader_archive(shader_archive&&) noexcept = default;
+		shader_archive(const shader_archive&) = delete;
+		shader_archive& operator=(shader_archive&&) noexcept = default;
+		shader_archive& operator=(const shader_archive&) = delete;
+		~shader_archive() = default;
+
+		/**	Memory-map the archive at the given path and validate its index.
+		 *	Throws an avk::runtime_error if the file can not be mapped or is malformed.
+		 */
+		static shader_archive open(std::string aPath);
+
+		/**	Find the SPIR-V code of the shader which has been packed with the given path.
+		 *	@return	A span into the memory-mapped file, which stays valid as long as this archive is alive.
+		 */
+		std::optional<std::span<const uint32_t>> find(std::string_view aShaderPath) const;
+
+		bool contains(std::string_view aShaderPath) const { return find(aShaderPath).has_value(); }
+
+		const auto& path() const { return mPath; }
+		auto num_entries() const { return mEntries.size(); }
+
+		/**	Open the archive at the given path and add it to the globally mounted archives.
+		 *	Archives that are mounted later take precedence over archives that have been mounted earlier.
+		 */
+		static void mount(std::string aPath);
+
+		/** Remove the archive which has been mounted from the given path. */
+		static void unmount(std::string_view aPath);
+
+		/** Remove all mounted archives. */
+		static void unmount_all();
+
+		/** A shader which has been found in one of the mounted archives */
+		struct mounted_shader_code
+		{
+			/** Path of the archive that contains the shader */
+			std::string mArchivePath;
+			/** The SPIR-V code, pointing into the archive's mapping */
+			std::span<const uint32_t> mCode;
+			/** Keeps the mapping alive, s.t. mCode stays valid even if the archive is unmounted in the meantime */
+			std::shared_ptr<const std::byte> mMapping;
+		};
+
+		/**	Search all mounted archives for the given shader path.
+		 *	@return	The shader's code together with the archive mapping which it points into. Hold on to it until the code has been consumed.
+		 */
+		static std::optional<mounted_shader_code> find_in_mounted(std::string_view aShaderPath);
+
+	private:
+		std::string mPath;
+		// Unmaps the file when the last reference is gone:
+		std::shared_ptr<const std::byte> mMapping;
+		size_t mMappingSize = 0;
+		std::span<const shader_archive_entry> mEntries;
+	};
+}
@@ -0,0 +1,80 @@
+#pragma once
+// Note: This header intentionally does not depend on avk.hpp or Vulkan, so that it
+//       can also be used by tools (like the shader archive packer).
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace avk
+{
+	/**	Binary layout of a packed shader archive:
+	 *
+	 *	 [shader_archive_header]
+	 *	 [shader_archive_entry] * mEntryCount        (sorted by mPathHash in ascending order)
+	 *	 [SPIR-V blobs]                              (each one starting at a 4-byte aligned offset)
+	 *
+	 *	All values are stored in little endian byte order.
+	 */
+	struct shader_archive_header
+	{
+		uint32_t mMagic;
+		uint32_t mVersion;
+		uint32_t mEntryCount;
+		uint32_t mReserved;
+	};
+
+	struct shader_archive_entry
+	{
+		/** Hash of the normalized path, see shader_archive_path_hash */
+		uint64_t mPathHash;
+		/** Offset of the SPIR-V blob, in bytes, from the beginning of the file */
+		uint64_t mOffset;
+		/** Size of the SPIR-V blob in bytes; always a multiple of 4 */
+		uint64_t mSize;
+	};
+
+	static_assert(sizeof(shader_archive_header) == 16);
+	static_assert(sizeof(shader_archive_entry) == 24);
+
+	/** "AVKS" */
+	inline constexpr uint32_t shader_archive_magic = 0x534B5641u;
+	inline constexpr uint32_t shader_archive_version = 1u;
+	inline constexpr uint64_t shader_archive_blob_alignment = 4u;
+
+	/**	Normalizes a shader path so that it can be used as lookup key into a shader archive:
+	 *	Leading/trailing spaces and leading "./" are removed, all separators are turned into
+	 *	forward slashes, and consecutive separators are collapsed into one.
+	 */
+	inline std::string shader_archive_normalize_path(std::string_view aPath)
+	{
+		while (!aPath.empty() && aPath.front() == ' ') { aPath.remove_prefix(1); }
+		while (!aPath.empty() && aPath.back() == ' ') { aPath.remove_suffix(1); }
+
+		std::string result;
+		result.reserve(aPath.size());
+		for (auto c : aPath) {
+			if (c == '\\') {
+				c = '/';
+			}
+			if (c == '/' && !result.empty() && result.back() == '/') {
+				continue;
+			}
+			result.push_back(c);
+		}
+		while (result.starts_with("./")) {
+			result.erase(0, 2);
+		}
+		return result;
+	}
+
+	/** 64-bit FNV-1a hash of the normalized path */
+	inline uint64_t shader_archive_path_hash(std::string_view aPath)
+	{
+		uint64_t hash = 0xcbf29ce484222325ull;
+		for (auto c : shader_archive_normalize_path(aPath)) {
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 0x100000001b3ull;
+		}
+		return hash;
+	}
+}
@@ -7,7 +7,28 @@ namespace avk
 	{
 		uint32_t num_entries() const { return static_cast<uint32_t>(mMapEntries.size()); }
 		size_t data_size() const { return mData.size() * sizeof(decltype(mData)::value_type); }
-		
+
+		/**	Set the value of the specialization constant with the given ID.
+		 *	Values are packed tightly, i.e. only aligned to aAlignment (which should be the natural alignment of
+		 *	the value's type) instead of being padded. If there already is a constant with the same ID and size,
+		 *	its value is overwritten in place.
+		 */
+		void set(uint32_t aConstantId, const void* aValue, size_t aSize, size_t aAlignment)
+		{
+			auto it = std::find_if(std::begin(mMapEntries), std::end(mMapEntries), [aConstantId](const vk::SpecializationMapEntry& aEntry) { return aEntry.constantID == aConstantId; });
+			if (std::end(mMapEntries) != it) {
+				if (it->size == aSize) {
+					memcpy(mData.data() + it->offset, aValue, aSize);
+					return;
+				}
+				mMapEntries.erase(it);
+			}
+			const auto offset = (mData.size() + aAlignment - 1) / aAlignment * aAlignment;
+			mData.resize(offset + aSize);
+			memcpy(mData.data() + offset, aValue, aSize);
+			mMapEntries.emplace_back(aConstantId, static_cast<uint32_t>(offset), aSize);
+		}
+
 		std::vector<vk::SpecializationMapEntry> mMapEntries;
 		std::vector<uint8_t> mData;
 	};
@@ -49,19 +70,14 @@ namespace avk
 			if (!mSpecializationConstants.has_value()) {
 				mSpecializationConstants = specialization_constants{};
 			}
-			auto& entries = mSpecializationConstants->mMapEntries;
-			auto& data = mSpecializationConstants->mData;
-
-			const auto align = sizeof(uint64_t); 
-			const auto currentSize = data.size();
-			const auto insertSize = sizeof(T);
-			const auto numAlloc = std::max(align, insertSize / sizeof(typename decltype(mSpecializationConstants->mData)::value_type));
-			assert (insertSize % sizeof(typename decltype(mSpecializationConstants->mData)::value_type) == 0);
-			data.resize(currentSize + numAlloc);
-			// copy data:
-			memcpy(data.data() + currentSize, &aValue, insertSize);
-			// make entry:
-			entries.emplace_back(aConstantId, static_cast<uint32_t>(currentSize), insertSize);
+			if constexpr (std::is_same_v<T, bool>) {
+				// Boolean specialization constants are 32 bits wide:
+				const vk::Bool32 value = aValue ? VK_TRUE : VK_FALSE;
+				mSpecializationConstants->set(aConstantId, &value, sizeof(value), alignof(vk::Bool32));
+			}
+			else {
+				mSpecializationConstants->set(aConstantId, &aValue, sizeof(T), alignof(T));
+			}
 
 			return *this;
 		}
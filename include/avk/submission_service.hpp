@@ -0,0 +1,101 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+#if VK_HEADER_VERSION >= 135
+	/**	Submits to one queue from a dedicated thread. vk::Queue must be externally synchronized; instead of
+	 *	guarding every submission with a mutex, recording threads push their batches into a lock-free
+	 *	multi-producer single-consumer queue, and the submission thread takes all batches which have piled
+	 *	up and submits them with a single vkQueueSubmit call, one vk::SubmitInfo per batch.
+	 *
+	 *	Every batch signals the next value of the queue's timeline semaphore, i.e., it is tracked by a
+	 *	completion_token as with queue::submit_with_completion_token. The service takes ownership of the
+	 *	command buffers and keeps them alive until their batch has completed, which is detected by the given
+	 *	completion_dispatcher. It also invokes the batches' completion callbacks and the command buffers'
+	 *	completion handlers. Requires the timelineSemaphore feature.
+	 *
+	 *	While a submission_service exists for a queue, submit to that queue only through it.
+	 *	submit and flush are thread-safe.
+	 */
+	class submission_service
+	{
+	public:
+		/** One submission, which becomes one vk::SubmitInfo */
+		struct batch
+		{
+			std::vector<command_buffer> mCommandBuffers;
+			/** Submissions which must have completed before the command buffers execute */
+			std::vector<completion_token> mWaitFor;
+			/** The stages of the command buffers which must wait for mWaitFor */
+			vk::PipelineStageFlags mWaitStage = vk::PipelineStageFlagBits::eAllCommands;
+			/** Binary semaphores to wait on, e.g., a swap chain image's availability, and the stages which wait on them */
+			std::vector<std::tuple<vk::Semaphore, vk::PipelineStageFlags>> mWaitSemaphores;
+			/** Binary semaphores to signal in addition to the timeline semaphore, e.g., for presentation */
+			std::vector<vk::Semaphore> mSignalSemaphores;
+			/** Invoked by the completion_dispatcher once the batch has completed */
+			std::vector<avk::unique_function<void()>> mCompletionCallbacks;
+		};
+
+		/**	Start the submission thread.
+		 *	@param	aQueue					The queue to submit to. It must outlive the service.
+		 *	@param	aCompletionDispatcher	Detects the completion of the batches. It must outlive the service,
+		 *									and either be polled regularly or run its background thread.
+		 */
+		submission_service(queue& aQueue, completion_dispatcher& aCompletionDispatcher);
+		submission_service(submission_service&&) = delete;
+		submission_service(const submission_service&) = delete;
+		submission_service& operator=(submission_service&&) = delete;
+		submission_service& operator=(const submission_service&) = delete;
+		/** Submits all batches which have been pushed so far, then stops the submission thread. */
+		~submission_service();
+
+		/**	Push a batch to be submitted by the submission thread. Does not block.
+		 *	The command buffers must have finished recording. Their post-execution handlers are invoked on the submission thread.
+		 *	@return	Becomes ready with the batch's completion token once it has been submitted. If the submission
+		 *			failed, it holds the exception instead.
+		 */
+		std::future<completion_token> submit(batch aBatch);
+
+		/** Block until all batches which have been pushed before this call have been submitted. */
+		void flush();
+
+		/** Number of batches which have been submitted so far */
+		uint64_t number_of_submitted_batches() const { return mNumberOfSubmittedBatches.load(std::memory_order_acquire); }
+		/** Number of vkQueueSubmit calls which have been made so far. The lower it is compared to the batches, the more have been coalesced. */
+		uint64_t number_of_submit_calls() const { return mNumberOfSubmitCalls.load(std::memory_order_acquire); }
+
+	private:
+		struct pending_batch
+		{
+			batch mBatch;
+			std::promise<completion_token> mPromise;
+		};
+
+		// Node of the intrusive MPSC queue. A node without a pending batch tells the submission thread to stop.
+		struct node
+		{
+			std::unique_ptr<pending_batch> mPending;
+			std::atomic<node*> mNext{ nullptr };
+		};
+
+		// Producer side; wait-free:
+		void push(std::unique_ptr<pending_batch> aPending);
+		// Consumer side, i.e., submission thread only. Returns false if no (fully pushed) node is available:
+		bool try_pop(std::unique_ptr<pending_batch>& aPending);
+		void submission_thread_loop();
+		void submit_coalesced(std::vector<std::unique_ptr<pending_batch>>& aBatches);
+
+		queue* mQueue;
+		completion_dispatcher* mCompletionDispatcher;
+		// Producers append at the head; the submission thread removes from the tail, which is a stub node:
+		std::atomic<node*> mHead;
+		node* mTail;
+		// Incremented after each push; the submission thread waits on it while the queue is empty:
+		std::atomic<uint64_t> mNumberOfPushedBatches{ 0 };
+		std::atomic<uint64_t> mNumberOfSubmittedBatches{ 0 };
+		std::atomic<uint64_t> mNumberOfSubmitCalls{ 0 };
+		std::thread mSubmissionThread;
+	};
+#endif
+}
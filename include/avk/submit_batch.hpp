@@ -0,0 +1,73 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Collects submissions to one queue, each with its command buffers and wait and signal semaphores,
+	 *	and submits all of them with a single vkQueueSubmit2 or vkQueueSubmit call. A frame which would
+	 *	otherwise submit dozens of times thereby pays the kernel and driver overhead of a submission once.
+	 *	The submissions execute in the order in which they have been added.
+	 *
+	 *	Implicit command buffers of avk::sync can be added to a batch instead of being submitted
+	 *	immediately, via avk::sync::into_batch.
+	 *	A submit_batch is not thread-safe.
+	 */
+	class submit_batch
+	{
+	public:
+		/**	Create an empty batch.
+		 *	@param	aQueue					The queue to submit to. It must outlive the batch.
+		 *	@param	aSubmit2DispatchLoader	If set, the batch is submitted via vkQueueSubmit2 (or vkQueueSubmit2KHR), which
+		 *									requires the synchronization2 feature. Otherwise, via vkQueueSubmit.
+		 */
+		submit_batch(queue& aQueue, const DISPATCH_LOADER_EXT_TYPE* aSubmit2DispatchLoader = nullptr);
+		submit_batch(submit_batch&&) noexcept = default;
+		submit_batch(const submit_batch&) = delete;
+		submit_batch& operator=(submit_batch&&) noexcept = default;
+		submit_batch& operator=(const submit_batch&) = delete;
+		~submit_batch() = default;
+
+		queue& get_queue() const { return *mQueue; }
+		/** Number of submissions, i.e., vk::SubmitInfo(2) entries, which have been added since the last submit */
+		size_t size() const { return mSubmissions.size(); }
+		bool empty() const { return mSubmissions.empty(); }
+
+		/**	Add one submission. The command buffers must stay alive until the fence which submit() returns has been signaled.
+		 *	@param	aWaitSemaphores		Semaphores to wait on at their semaphore_wait_stage(). They are kept alive with the fence.
+		 *	@param	aSignalSemaphores	Semaphores to signal once the command buffers have completed
+		 */
+		submit_batch& add(std::vector<resource_reference<command_buffer_t>> aCommandBuffers, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores = {}, std::vector<resource_reference<semaphore_t>> aSignalSemaphores = {});
+
+		/**	Add one submission and take ownership of its command buffers, which are kept alive with the fence that submit() returns.
+		 *	@param	aWaitSemaphores		Semaphores to wait on at their semaphore_wait_stage(). They are kept alive with the fence.
+		 *	@param	aSignalSemaphores	Semaphores to signal once the command buffers have completed
+		 */
+		submit_batch& add_owned(std::vector<resource_ownership<command_buffer_t>> aCommandBuffers, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores = {}, std::vector<resource_reference<semaphore_t>> aSignalSemaphores = {});
+
+		/**	Submit all submissions which have been added, with one call, and clear the batch.
+		 *	The post-execution handlers of the command buffers are invoked in submission order.
+		 *	@return	A fence from the queue's fence_pool, which is signaled once all submissions have completed.
+		 *			Owned command buffers and wait semaphores are destroyed together with it.
+		 */
+		fence submit();
+
+	private:
+		struct submission
+		{
+			// Either referenced or owned ones, depending on whether it has been added via add or add_owned:
+			std::vector<resource_reference<command_buffer_t>> mCommandBuffers;
+			std::vector<command_buffer> mOwnedCommandBuffers;
+			std::vector<vk::Semaphore> mWaitSemaphores;
+			std::vector<vk::PipelineStageFlags> mWaitStages;
+			std::vector<vk::Semaphore> mSignalSemaphores;
+		};
+
+		submission& add_submission(std::vector<resource_ownership<semaphore_t>>& aWaitSemaphores, std::vector<resource_reference<semaphore_t>>& aSignalSemaphores);
+
+		queue* mQueue;
+		const DISPATCH_LOADER_EXT_TYPE* mSubmit2DispatchLoader;
+		std::vector<submission> mSubmissions;
+		// Kept alive until the submissions have completed:
+		std::vector<semaphore> mOwnedSemaphores;
+	};
+}
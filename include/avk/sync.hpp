@@ -9,7 +9,13 @@ namespace avk
 	class sync
 	{
 	public:
-		static command_pool sPoolToAllocCommandBuffersFrom;
+		/**	Implicit command buffers are allocated from the calling thread's pool for the family of queue_to_use().
+		 *	Set it up via root::create_command_pool_manager, and reset it before the device is destroyed.
+		 *	Before destroying the device, also call queue::release_sync_objects on every queue, after all fences
+		 *	from its pool have been destroyed: Queues destroy their fence pool and timeline semaphore otherwise
+		 *	only in their destructor, which might run after the device is gone.
+		 */
+		static command_pool_manager sCommandPoolManager;
 		static queue* sQueueToUse;
 		
 		struct presets
@@ -31,7 +37,7 @@ namespace avk
 			};
 		};
 		
-		enum struct sync_type { not_required, by_return, by_existing_command_buffer, via_wait_idle, via_wait_idle_deliberately, via_semaphore, via_barrier };
+		enum struct sync_type { not_required, by_return, by_existing_command_buffer, via_wait_idle, via_wait_idle_deliberately, via_semaphore, via_barrier, via_completion_token, via_batch };
 		enum struct commandbuffer_request { not_specified, single_use, reusable };
 		using steal_before_handler_t = void(*)(command_buffer_t&, pipeline_stage, std::optional<read_memory_access>);
 		using steal_after_handler_t = void(*)(command_buffer_t&, pipeline_stage, std::optional<write_memory_access>);
@@ -89,6 +95,38 @@ namespace avk
 			return result;
 		}
 
+#if VK_HEADER_VERSION >= 135
+		/**	Establish synchronization via the timeline semaphore of the queue, see queue::submit_with_completion_token.
+		 *	Unlike with_semaphore, no semaphore is created, and no global memory barrier is recorded: Signaling the
+		 *	timeline semaphore makes all memory writes of the operation available, and waiting for the token makes them visible.
+		 *	@tparam F							void(completion_token, command_buffer)
+		 *	@param	aCompletionHandler			Receives the token of the operation and its command buffer, which must
+		 *										be kept alive until the token has completed.
+		 *	@param	aWaitBeforeOperation		Submissions which must have completed before the operation executes
+		 */
+		template <typename F>
+		static sync with_completion_token(F&& aCompletionHandler, std::vector<completion_token> aWaitBeforeOperation = {})
+		{
+			sync result;
+			result.mCompletionTokenHandler = std::forward<F>(aCompletionHandler);
+			result.mWaitBeforeTokens = std::move(aWaitBeforeOperation);
+			return result;
+		}
+#endif
+
+		/**	Defer the submission into the given batch instead of submitting immediately. Like with_semaphore, a global
+		 *	memory barrier is recorded at the end of the operation, s.t. later submissions to the same queue see its results.
+		 *	The batch takes ownership of the command buffer, which is kept alive with the fence that submit_batch::submit returns.
+		 *	@param	aBatch		The batch to add the operation's command buffer to. Its queue must be of the family
+		 *						which implicit command buffers are allocated for, see queue_to_use().
+		 */
+		static sync into_batch(submit_batch& aBatch)
+		{
+			sync result;
+			result.mBatch = &aBatch;
+			return result;
+		}
+
 		/**	Establish barrier-based synchronization and return the resulting command buffer from the operation.
 		 *	Note: Not all operations support this type of synchronization. You can notice them by a method
 		 *	      signature that does NOT return `std::optional<command_buffer>`.
@@ -228,6 +266,11 @@ namespace avk
 		commandbuffer_request mCommandbufferRequest;
 		avk::unique_function<void(semaphore)> mSemaphoreLifetimeHandler;
 		std::vector<semaphore> mWaitBeforeSemaphores;
+#if VK_HEADER_VERSION >= 135
+		avk::unique_function<void(completion_token, command_buffer)> mCompletionTokenHandler;
+		std::vector<completion_token> mWaitBeforeTokens;
+#endif
+		submit_batch* mBatch = nullptr;
 		std::variant<std::monostate, avk::unique_function<void(command_buffer)>, std::reference_wrapper<command_buffer_t>> mCommandBufferRefOrLifetimeHandler;
 		std::optional<command_buffer> mCommandBuffer;
 		avk::unique_function<void(command_buffer_t&, pipeline_stage /* destination stage */, std::optional<read_memory_access> /* destination access */)> mEstablishBarrierBeforeOperationCallback;
@@ -29,6 +29,52 @@ namespace avk
 		return false;
 	}
 
+	namespace
+	{
+		// The device extensions which have been recorded via root::record_enabled_device_extensions, per device
+		struct enabled_device_extensions_record
+		{
+			std::shared_mutex mMutex;
+			std::unordered_map<VkDevice, std::vector<std::string>> mExtensions;
+		};
+
+		enabled_device_extensions_record& enabled_device_extensions()
+		{
+			static enabled_device_extensions_record sRecord;
+			return sRecord;
+		}
+	}
+
+	void root::record_enabled_device_extensions(vk::Device aDevice, const vk::DeviceCreateInfo& aDeviceCreateInfo)
+	{
+		std::vector<std::string> extensions;
+		extensions.reserve(aDeviceCreateInfo.enabledExtensionCount);
+		for (uint32_t i = 0; i < aDeviceCreateInfo.enabledExtensionCount; ++i) {
+			extensions.emplace_back(aDeviceCreateInfo.ppEnabledExtensionNames[i]);
+		}
+		auto& record = enabled_device_extensions();
+		std::unique_lock lock(record.mMutex);
+		record.mExtensions[static_cast<VkDevice>(aDevice)] = std::move(extensions);
+	}
+
+	void root::forget_enabled_device_extensions(vk::Device aDevice)
+	{
+		auto& record = enabled_device_extensions();
+		std::unique_lock lock(record.mMutex);
+		record.mExtensions.erase(static_cast<VkDevice>(aDevice));
+	}
+
+	bool root::is_device_extension_enabled(vk::Device aDevice, std::string_view aExtensionName)
+	{
+		auto& record = enabled_device_extensions();
+		std::shared_lock lock(record.mMutex);
+		const auto it = record.mExtensions.find(static_cast<VkDevice>(aDevice));
+		if (std::end(record.mExtensions) == it) {
+			return false;
+		}
+		return std::end(it->second) != std::find(std::begin(it->second), std::end(it->second), aExtensionName);
+	}
+
 #if VK_HEADER_VERSION >= 135
 #if VK_HEADER_VERSION >= 162
 	vk::PhysicalDeviceRayTracingPipelinePropertiesKHR root::get_ray_tracing_properties()
@@ -2128,6 +2174,139 @@ namespace avk
 #pragma endregion
 
 #pragma region binding_data definitions
+	namespace
+	{
+		template <typename T>
+		struct is_std_vector : std::false_type {};
+		template <typename T, typename A>
+		struct is_std_vector<std::vector<T, A>> : std::true_type {};
+
+		// Invokes aFunc for each single descriptor of the given resource, passing either a vk::DescriptorImageInfo,
+		// a vk::DescriptorBufferInfo, a vk::BufferView, or a vk::AccelerationStructureKHR:
+		template <typename R, typename F>
+		void for_each_descriptor_of(const R* aResource, F& aFunc)
+		{
+			if constexpr (std::is_same_v<R, buffer_view_t> || std::is_same_v<R, buffer_view_descriptor>) {
+				aFunc(aResource->view_handle());
+			}
+			else if constexpr (std::is_same_v<R, top_level_acceleration_structure_t>) {
+#if VK_HEADER_VERSION >= 135
+				const auto& info = aResource->descriptor_info();
+				for (uint32_t i = 0u; i < info.accelerationStructureCount; ++i) {
+					aFunc(info.pAccelerationStructures[i]);
+				}
+#endif
+			}
+			else {
+				aFunc(aResource->descriptor_info());
+			}
+		}
+
+		template <typename F>
+		void for_each_descriptor(const binding_data& aBinding, F&& aFunc)
+		{
+			std::visit([&aFunc](const auto& aResource) {
+				using T = std::decay_t<decltype(aResource)>;
+				if constexpr (is_std_vector<T>::value) {
+					for (const auto* r : aResource) {
+						for_each_descriptor_of(r, aFunc);
+					}
+				}
+				else if constexpr (!std::is_same_v<T, std::monostate>) {
+					for_each_descriptor_of(aResource, aFunc);
+				}
+			}, aBinding.mResourcePtr);
+		}
+
+		// Let aWrite point directly to the descriptor info which the binding's single resource holds. This avoids
+		// gathering the descriptor data, but is not possible for arrays of resources and acceleration structures:
+		bool point_write_to_resource(const binding_data& aBinding, vk::WriteDescriptorSet& aWrite)
+		{
+			aWrite = vk::WriteDescriptorSet{}
+				.setDstBinding(aBinding.mLayoutBinding.binding)
+				.setDescriptorCount(1u)
+				.setDescriptorType(aBinding.mLayoutBinding.descriptorType);
+			return std::visit([&aWrite](const auto& aResource) -> bool {
+				using T = std::decay_t<decltype(aResource)>;
+				if constexpr (is_std_vector<T>::value || std::is_same_v<T, std::monostate> || std::is_same_v<T, const top_level_acceleration_structure_t*>) {
+					return false;
+				}
+				else if constexpr (std::is_same_v<T, const buffer_view_t*> || std::is_same_v<T, const buffer_view_descriptor*>) {
+					aWrite.setPTexelBufferView(&aResource->view_handle());
+					return true;
+				}
+				else if constexpr (std::is_same_v<std::decay_t<decltype(aResource->descriptor_info())>, vk::DescriptorImageInfo>) {
+					aWrite.setPImageInfo(&aResource->descriptor_info());
+					return true;
+				}
+				else {
+					aWrite.setPBufferInfo(&aResource->descriptor_info());
+					return true;
+				}
+			}, aBinding.mResourcePtr);
+		}
+	}
+
+	uint64_t binding_data::compute_content_hash() const
+	{
+		size_t h = 0; // 64 bits wide on all supported (x64) platforms
+		hash_combine(h, mLayoutBinding.binding, static_cast<VkDescriptorType>(mLayoutBinding.descriptorType), descriptor_count());
+		for_each_descriptor(*this, [&h](const auto& aDescriptor) {
+			using D = std::decay_t<decltype(aDescriptor)>;
+			if constexpr (std::is_same_v<D, vk::DescriptorImageInfo>) {
+				hash_combine(h, static_cast<VkSampler>(aDescriptor.sampler), static_cast<VkImageView>(aDescriptor.imageView), static_cast<VkImageLayout>(aDescriptor.imageLayout));
+			}
+			else if constexpr (std::is_same_v<D, vk::DescriptorBufferInfo>) {
+				hash_combine(h, static_cast<VkBuffer>(aDescriptor.buffer), aDescriptor.offset, aDescriptor.range);
+			}
+			else {
+				hash_combine(h, static_cast<typename D::CType>(aDescriptor));
+			}
+		});
+		return static_cast<uint64_t>(h);
+	}
+
+	bool binding_data::matches(const vk::WriteDescriptorSet& aWrite) const
+	{
+		if (aWrite.dstBinding != mLayoutBinding.binding || aWrite.dstArrayElement != 0u || aWrite.descriptorType != mLayoutBinding.descriptorType || aWrite.descriptorCount != descriptor_count()) {
+			return false;
+		}
+
+		bool result = true;
+		uint32_t i = 0u;
+		for_each_descriptor(*this, [&](const auto& aDescriptor) {
+			using D = std::decay_t<decltype(aDescriptor)>;
+			if (!result) {
+				return;
+			}
+			if constexpr (std::is_same_v<D, vk::DescriptorImageInfo>) {
+				result = nullptr != aWrite.pImageInfo && aWrite.pImageInfo[i] == aDescriptor;
+			}
+			else if constexpr (std::is_same_v<D, vk::DescriptorBufferInfo>) {
+				result = nullptr != aWrite.pBufferInfo && aWrite.pBufferInfo[i] == aDescriptor;
+			}
+			else if constexpr (std::is_same_v<D, vk::BufferView>) {
+				result = nullptr != aWrite.pTexelBufferView && aWrite.pTexelBufferView[i] == aDescriptor;
+			}
+			else {
+#if VK_HEADER_VERSION >= 135
+				// All acceleration structures of one binding are accumulated into ONE pNext write:
+				const auto* asWrite = reinterpret_cast<const vk::WriteDescriptorSetAccelerationStructureKHR*>(aWrite.pNext);
+				result = nullptr != asWrite && i < asWrite->accelerationStructureCount && asWrite->pAccelerationStructures[i] == aDescriptor;
+#endif
+			}
+			++i;
+		});
+
+#if VK_HEADER_VERSION >= 135
+		if (result && vk::DescriptorType::eAccelerationStructureKHR == aWrite.descriptorType) {
+			const auto* asWrite = reinterpret_cast<const vk::WriteDescriptorSetAccelerationStructureKHR*>(aWrite.pNext);
+			result = nullptr != asWrite && asWrite->accelerationStructureCount == i;
+		}
+#endif
+		return result;
+	}
+
 	uint32_t binding_data::descriptor_count() const
 	{
 		if (std::holds_alternative<std::vector<const buffer_t*>>(mResourcePtr)) { return static_cast<uint32_t>(std::get<std::vector<const buffer_t*>>(mResourcePtr).size()); }
@@ -2731,17 +2910,257 @@ namespace avk
 		result.mRoot = this;
 		result.mCreateInfo = createInfo;
 		result.mCommandPool = std::make_shared<vk::UniqueHandle<vk::CommandPool, DISPATCH_LOADER_CORE_TYPE>>(device().createCommandPoolUnique(createInfo, nullptr, dispatch_loader_core()));
+		result.mFreeList = std::make_shared<command_buffer_free_list>();
+		return result;
+	}
+
+	command_pool_manager root::create_command_pool_manager(vk::CommandPoolCreateFlags aCreateFlags)
+	{
+		command_pool_manager result;
+		result.mRoot = this;
+		result.mCreateFlags = aCreateFlags;
+		result.mMutex = std::make_unique<std::mutex>();
+		result.mParallelRecordingMutex = std::make_unique<std::mutex>();
+		result.mRecordingWorkers = std::make_unique<recording_workers>();
+		return result;
+	}
+
+	command_pool_t& command_pool_manager::pool_for_this_thread(uint32_t aQueueFamilyIndex)
+	{
+		if (nullptr == mRoot) {
+			throw avk::runtime_error("The command_pool_manager has not been initialized. Create it via root::create_command_pool_manager.");
+		}
+		const auto key = std::make_tuple(std::this_thread::get_id(), aQueueFamilyIndex);
+		std::scoped_lock guard(*mMutex);
+		auto it = mPools.find(key);
+		if (std::end(mPools) == it) {
+			it = mPools.emplace(key, mRoot->create_command_pool(aQueueFamilyIndex, mCreateFlags)).first;
+		}
+		// The map's nodes are stable, and no other thread ever uses this pool:
+		return it->second.get();
+	}
+
+	std::vector<command_buffer> command_pool_manager::alloc_command_buffers(uint32_t aQueueFamilyIndex, uint32_t aCount, vk::CommandBufferUsageFlags aUsageFlags, vk::CommandBufferLevel aLevel)
+	{
+		return pool_for_this_thread(aQueueFamilyIndex).alloc_command_buffers(aCount, aUsageFlags, aLevel);
+	}
+
+	command_buffer command_pool_manager::alloc_command_buffer(uint32_t aQueueFamilyIndex, vk::CommandBufferUsageFlags aUsageFlags, vk::CommandBufferLevel aLevel)
+	{
+		return pool_for_this_thread(aQueueFamilyIndex).alloc_command_buffer(aUsageFlags, aLevel);
+	}
+
+	void command_pool_manager::reset_pools_of_this_thread(vk::CommandPoolResetFlags aFlags)
+	{
+		if (!mMutex) {
+			return;
+		}
+		const auto threadId = std::this_thread::get_id();
+		std::scoped_lock guard(*mMutex);
+		for (auto& [key, pool] : mPools) {
+			if (std::get<std::thread::id>(key) == threadId) {
+				pool->reset(aFlags);
+			}
+		}
+	}
+
+	size_t command_pool_manager::number_of_pools() const
+	{
+		if (!mMutex) {
+			return 0;
+		}
+		std::scoped_lock guard(*mMutex);
+		return mPools.size() + mParallelRecordingPools.size();
+	}
+
+	std::vector<command_buffer> command_pool_manager::record_secondaries_in_parallel(uint32_t aQueueFamilyIndex, const vk::CommandBufferInheritanceInfo& aInheritanceInfo, uint32_t aNumberOfChunks, const std::function<void(command_buffer_t&, uint32_t)>& aRecordChunk, uint32_t aMaxThreads)
+	{
+		if (nullptr == mRoot) {
+			throw avk::runtime_error("The command_pool_manager has not been initialized. Create it via root::create_command_pool_manager.");
+		}
+		if (0u == aNumberOfChunks) {
+			return {};
+		}
+		std::scoped_lock recordingGuard(*mParallelRecordingMutex);
+
+		// Look up all the workers' pools up front, s.t. the workers do not have to lock anything:
+		const auto numThreads = std::min(aNumberOfChunks, 0 == aMaxThreads ? std::max(1u, std::thread::hardware_concurrency()) : aMaxThreads);
+		std::vector<command_pool_t*> pools(numThreads);
+		{
+			std::scoped_lock guard(*mMutex);
+			for (uint32_t i = 0; i < numThreads; ++i) {
+				const auto key = std::make_tuple(i, aQueueFamilyIndex);
+				auto it = mParallelRecordingPools.find(key);
+				if (std::end(mParallelRecordingPools) == it) {
+					it = mParallelRecordingPools.emplace(key, mRoot->create_command_pool(aQueueFamilyIndex, mCreateFlags)).first;
+				}
+				pools[i] = &it->second.get();
+			}
+		}
+
+		std::vector<std::optional<command_buffer>> secondaries(aNumberOfChunks);
+		std::vector<std::exception_ptr> errors(numThreads);
+		std::atomic<uint32_t> nextChunk{ 0 };
+		const std::function<void(uint32_t)> worker = [&](uint32_t aWorkerIndex) {
+			try {
+				for (uint32_t chunk = nextChunk++; chunk < aNumberOfChunks; chunk = nextChunk++) {
+					auto cb = pools[aWorkerIndex]->alloc_command_buffer(vk::CommandBufferUsageFlagBits::eOneTimeSubmit, vk::CommandBufferLevel::eSecondary);
+					cb->begin_recording(aInheritanceInfo);
+					aRecordChunk(cb.get(), chunk);
+					cb->end_recording();
+					secondaries[chunk] = std::move(cb);
+				}
+			}
+			catch (...) {
+				// Let the other workers stop early:
+				nextChunk = aNumberOfChunks;
+				errors[aWorkerIndex] = std::current_exception();
+			}
+		};
+
+		// The calling thread is worker 0, the persistent threads take the others:
+		mRecordingWorkers->start(worker, numThreads);
+		worker(0u);
+		mRecordingWorkers->wait();
+		for (auto& error : errors) {
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+
+		// Deterministic order, regardless of which thread has recorded which chunk:
+		std::vector<command_buffer> result;
+		result.reserve(aNumberOfChunks);
+		for (auto& secondary : secondaries) {
+			result.push_back(std::move(secondary.value()));
+		}
 		return result;
 	}
 
+	command_pool_manager::recording_workers::~recording_workers()
+	{
+		{
+			std::scoped_lock guard(mMutex);
+			mStop = true;
+		}
+		mJobPosted.notify_all();
+		for (auto& t : mThreads) {
+			t.join();
+		}
+	}
+
+	void command_pool_manager::recording_workers::start(const std::function<void(uint32_t)>& aJob, uint32_t aNumberOfWorkers)
+	{
+		std::scoped_lock guard(mMutex);
+		assert(nullptr == mJob);
+		// Start further threads on demand; they have not seen any job yet:
+		while (mThreads.size() + 1 < aNumberOfWorkers) {
+			mThreads.emplace_back(&recording_workers::worker_loop, this, static_cast<uint32_t>(mThreads.size() + 1), mJobId);
+		}
+		mJob = &aJob;
+		mNumberOfWorkers = aNumberOfWorkers;
+		mNumberOfBusyWorkers = aNumberOfWorkers - 1;
+		++mJobId;
+		mJobPosted.notify_all();
+	}
+
+	void command_pool_manager::recording_workers::wait()
+	{
+		std::unique_lock lock(mMutex);
+		mJobDone.wait(lock, [this]() { return 0u == mNumberOfBusyWorkers; });
+		mJob = nullptr;
+	}
+
+	void command_pool_manager::recording_workers::worker_loop(uint32_t aWorkerIndex, uint64_t aLastSeenJob)
+	{
+		std::unique_lock lock(mMutex);
+		while (true) {
+			mJobPosted.wait(lock, [&]() { return mStop || mJobId != aLastSeenJob; });
+			if (mStop) {
+				return;
+			}
+			aLastSeenJob = mJobId;
+			if (aWorkerIndex >= mNumberOfWorkers) {
+				continue; // Not needed for this job
+			}
+			const auto* job = mJob;
+			lock.unlock();
+			(*job)(aWorkerIndex); // Does not throw; it stores exceptions for the calling thread
+			lock.lock();
+			if (0u == --mNumberOfBusyWorkers) {
+				mJobDone.notify_all();
+			}
+		}
+	}
+
+	void command_pool_manager::release_pools_of_thread(std::thread::id aThreadId)
+	{
+		if (!mMutex) {
+			return;
+		}
+		std::scoped_lock guard(*mMutex);
+		for (auto it = std::begin(mPools); it != std::end(mPools);) {
+			if (std::get<std::thread::id>(it->first) == aThreadId) {
+				it = mPools.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+
 	std::vector<command_buffer> command_pool_t::alloc_command_buffers(uint32_t aCount, vk::CommandBufferUsageFlags aUsageFlags, vk::CommandBufferLevel aLevel)
 	{
-		auto bufferAllocInfo = vk::CommandBufferAllocateInfo()
-			.setCommandPool(handle())
-			.setLevel(aLevel)
-			.setCommandBufferCount(aCount);
+		const auto levelIndex = vk::CommandBufferLevel::ePrimary == aLevel ? 0 : 1;
+		const auto& dispatchLoader = mRoot->dispatch_loader_core();
+
+		// Hand out recycled handles first, starting with the ones which are in the initial state already:
+		std::vector<vk::CommandBuffer> tmp;
+		tmp.reserve(aCount);
+		size_t numToReset = 0;
+		{
+			std::scoped_lock guard(mFreeList->mMutex);
+			auto& initial = mFreeList->mInitial[levelIndex];
+			while (tmp.size() < aCount && !initial.empty()) {
+				tmp.push_back(initial.back());
+				initial.pop_back();
+			}
+			// Recorded ones can only be reset individually if the pool allows it; otherwise, they wait for reset():
+			if (mCreateInfo.flags & vk::CommandPoolCreateFlagBits::eResetCommandBuffer) {
+				auto& recorded = mFreeList->mRecorded[levelIndex];
+				while (tmp.size() < aCount && !recorded.empty()) {
+					tmp.push_back(recorded.back());
+					recorded.pop_back();
+					++numToReset;
+				}
+			}
+		}
+		// The pool is externally synchronized anyways, no need to hold the lock during the resets:
+		for (size_t i = tmp.size() - numToReset; i < tmp.size(); ++i) {
+			tmp[i].reset(vk::CommandBufferResetFlags{}, dispatchLoader);
+		}
+		// Without eResetCommandBuffer, recorded handles are only reusable after reset(). Free the ones which
+		// have been returned since, s.t. the free list does not grow unboundedly if reset() is never called:
+		if (!(mCreateInfo.flags & vk::CommandPoolCreateFlagBits::eResetCommandBuffer)) {
+			std::vector<vk::CommandBuffer> toFree;
+			{
+				std::scoped_lock guard(mFreeList->mMutex);
+				std::swap(toFree, mFreeList->mRecorded[levelIndex]);
+			}
+			if (!toFree.empty()) {
+				mCommandPool->getOwner().freeCommandBuffers(handle(), toFree, dispatchLoader);
+			}
+		}
 
-		auto tmp = mCommandPool->getOwner().allocateCommandBuffersUnique(bufferAllocInfo, mRoot->dispatch_loader_core());
+		// Allocate the remaining ones:
+		if (tmp.size() < aCount) {
+			auto bufferAllocInfo = vk::CommandBufferAllocateInfo()
+				.setCommandPool(handle())
+				.setLevel(aLevel)
+				.setCommandBufferCount(aCount - static_cast<uint32_t>(tmp.size()));
+			auto allocated = mCommandPool->getOwner().allocateCommandBuffers(bufferAllocInfo, dispatchLoader);
+			tmp.insert(std::end(tmp), std::begin(allocated), std::end(allocated));
+		}
 
 		// Iterate over all the "raw"-Vk objects in `tmp` and...
 		std::vector<command_buffer> buffers;
@@ -2749,13 +3168,15 @@ namespace avk
 		std::transform(std::begin(tmp), std::end(tmp),
 			std::back_inserter(buffers),
 			// ...transform them into `ak::command_buffer_t` objects:
-			[lUsageFlags = aUsageFlags, poolPtr = mCommandPool](auto& vkCb) -> command_buffer {
+			[this, lUsageFlags = aUsageFlags, aLevel, &dispatchLoader](vk::CommandBuffer vkCb) -> command_buffer {
 				command_buffer_t result;
+				result.mLevel = aLevel;
 				result.mBeginInfo = vk::CommandBufferBeginInfo()
 					.setFlags(lUsageFlags)
 					.setPInheritanceInfo(nullptr);
-				result.mCommandBuffer = std::move(vkCb);
-				result.mCommandPool = std::move(poolPtr);
+				result.mCommandBuffer = vk::UniqueHandle<vk::CommandBuffer, DISPATCH_LOADER_CORE_TYPE>(vkCb, vk::PoolFree<vk::Device, vk::CommandPool, DISPATCH_LOADER_CORE_TYPE>(mCommandPool->getOwner(), handle(), dispatchLoader));
+				result.mCommandPool = mCommandPool;
+				result.mFreeList = mFreeList;
 				return result;
 			});
 		return buffers;
@@ -2767,6 +3188,28 @@ namespace avk
 		return result;
 	}
 
+	void command_pool_t::reset(vk::CommandPoolResetFlags aFlags)
+	{
+		std::scoped_lock guard(mFreeList->mMutex);
+		mCommandPool->getOwner().resetCommandPool(handle(), aFlags, mRoot->dispatch_loader_core());
+		// All returned handles are in the initial state now:
+		for (size_t i = 0; i < mFreeList->mRecorded.size(); ++i) {
+			auto& recorded = mFreeList->mRecorded[i];
+			mFreeList->mInitial[i].insert(std::end(mFreeList->mInitial[i]), std::begin(recorded), std::end(recorded));
+			recorded.clear();
+		}
+	}
+
+	size_t command_pool_t::number_of_recycled_command_buffers() const
+	{
+		std::scoped_lock guard(mFreeList->mMutex);
+		size_t count = 0;
+		for (size_t i = 0; i < mFreeList->mInitial.size(); ++i) {
+			count += mFreeList->mInitial[i].size() + mFreeList->mRecorded[i].size();
+		}
+		return count;
+	}
+
 	// prepare command buffer for re-recording
 	void command_buffer_t::prepare_for_reuse()
 	{
@@ -2774,11 +3217,13 @@ namespace avk
 			// Clear post-execution handler
 			mPostExecutionHandler.reset();
 		}
-		if (mCustomDeleter.has_value() && *mCustomDeleter) {
-			// If there is a custom deleter => call it now
-			(*mCustomDeleter)();
-			mCustomDeleter.reset();
+		// Completion handlers which have not been handed over to a completion_dispatcher => the work has completed by now
+		for (auto& handler : mCompletionHandlers) {
+			handler();
 		}
+		mCompletionHandlers.clear();
+		// If there are custom deleters => call them now
+		invoke_in_reverse_order_and_clear(mCustomDeleters);
 	}
 
 	command_buffer_t::~command_buffer_t()
@@ -2788,6 +3233,15 @@ namespace avk
 		// additional functionality in the future which would not be appropriate
 		// to being executed from the destructor, don't call it anymore from here!
 		prepare_for_reuse();
+		// Return the handle to the pool's free list instead of freeing it. Like freeing, this requires
+		// the command buffer to have completed execution. No Vulkan call is made here, which makes it
+		// fine to destroy command buffers on other threads than the one which records into the pool.
+		if (mFreeList && mCommandBuffer) {
+			const auto levelIndex = vk::CommandBufferLevel::ePrimary == mLevel ? 0 : 1;
+			std::scoped_lock guard(mFreeList->mMutex);
+			auto& target = command_buffer_state::none == mState ? mFreeList->mInitial[levelIndex] : mFreeList->mRecorded[levelIndex];
+			target.push_back(mCommandBuffer.release());
+		}
 		// Destroy the dependant instance before destroying myself
 		// ^ This is ensured by the order of the members
 		//   See: https://isocpp.org/wiki/faq/dtors#calling-member-dtors
@@ -2802,8 +3256,33 @@ namespace avk
 
 	void command_buffer_t::begin_recording()
 	{
+		// Secondary command buffers need an inheritance info, even if they are not executed within a render pass:
+		if (vk::CommandBufferLevel::eSecondary == mLevel && !mInheritanceInfo.has_value()) {
+			mInheritanceInfo = vk::CommandBufferInheritanceInfo{};
+		}
+		// Set the pointer only now, since this instance might have been moved after the inheritance info has been set:
+		mBeginInfo.setPInheritanceInfo(mInheritanceInfo.has_value() ? &mInheritanceInfo.value() : nullptr);
 		mCommandBuffer->begin(mBeginInfo);
 		mState = command_buffer_state::recording;
+#if VK_HEADER_VERSION >= 204
+		reset_dynamic_state_tracking();
+#endif
+		reset_descriptor_set_tracking();
+	}
+
+	void command_buffer_t::begin_recording(const vk::CommandBufferInheritanceInfo& aInheritanceInfo)
+	{
+		if (vk::CommandBufferLevel::eSecondary != mLevel) {
+			throw avk::logic_error("Only secondary command buffers inherit state. Allocate the command buffer with vk::CommandBufferLevel::eSecondary.");
+		}
+		mInheritanceInfo = aInheritanceInfo;
+		if (aInheritanceInfo.renderPass) {
+			mBeginInfo.flags |= vk::CommandBufferUsageFlagBits::eRenderPassContinue;
+		}
+		else {
+			mBeginInfo.flags &= ~vk::CommandBufferUsageFlags{ vk::CommandBufferUsageFlagBits::eRenderPassContinue };
+		}
+		begin_recording();
 	}
 
 	void command_buffer_t::end_recording()
@@ -2831,6 +3310,9 @@ namespace avk
 
 		mSubpassContentsState = aSubpassesInline ? vk::SubpassContents::eInline : vk::SubpassContents::eSecondaryCommandBuffers;
 		mCommandBuffer->beginRenderPass(renderPassBeginInfo, mSubpassContentsState);
+		mCurrentRenderPass = aRenderpass->handle();
+		mCurrentFramebuffer = aFramebuffer->handle();
+		mCurrentSubpass = 0u;
 		// 2nd parameter: how the drawing commands within the render pass will be provided. It can have one of two values [7]:
 		//  - VK_SUBPASS_CONTENTS_INLINE: The render pass commands will be embedded in the primary command buffer itself and no secondary command buffers will be executed.
 		//  - VK_SUBPASS_CONTENTS_SECONDARY_command_buffer_tS : The render pass commands will be executed from secondary command buffers.
@@ -2866,6 +3348,52 @@ namespace avk
 	void command_buffer_t::next_subpass()
 	{
 		mCommandBuffer->nextSubpass(mSubpassContentsState);
+		++mCurrentSubpass;
+	}
+
+	vk::CommandBufferInheritanceInfo command_buffer_t::inheritance_info_for_current_subpass() const
+	{
+		if (!mCurrentRenderPass) {
+			throw avk::logic_error("No render pass is being recorded. Begin one via begin_render_pass_for_framebuffer first.");
+		}
+		if (vk::SubpassContents::eSecondaryCommandBuffers != mSubpassContentsState) {
+			throw avk::logic_error("The subpasses of the current render pass are recorded inline. Pass aSubpassesInline = false to begin_render_pass_for_framebuffer in order to execute secondary command buffers.");
+		}
+		return vk::CommandBufferInheritanceInfo{}
+			.setRenderPass(mCurrentRenderPass)
+			.setSubpass(mCurrentSubpass)
+			.setFramebuffer(mCurrentFramebuffer);
+	}
+
+	void command_buffer_t::execute_commands(std::vector<command_buffer> aSecondaryCommandBuffers)
+	{
+		if (aSecondaryCommandBuffers.empty()) {
+			return;
+		}
+		std::vector<vk::CommandBuffer> handles;
+		handles.reserve(aSecondaryCommandBuffers.size());
+		for (const auto& secondary : aSecondaryCommandBuffers) {
+			if (vk::CommandBufferLevel::eSecondary != secondary->level()) {
+				throw avk::logic_error("Only secondary command buffers can be executed via execute_commands.");
+			}
+			handles.push_back(secondary->handle());
+		}
+		mCommandBuffer->executeCommands(handles);
+
+		// State which has been set in the secondary command buffers does not carry over, and vice versa:
+		reset_descriptor_set_tracking();
+#if VK_HEADER_VERSION >= 204
+		reset_dynamic_state_tracking();
+#endif
+
+		auto secondaries = std::make_shared<std::vector<command_buffer>>(std::move(aSecondaryCommandBuffers));
+		set_post_execution_handler([secondaries]() {
+			for (const auto& secondary : *secondaries) {
+				secondary->invoke_post_execution_handler();
+			}
+		});
+		// Keep them alive until this command buffer is done:
+		set_custom_deleter([lSecondaries = std::move(secondaries)]() {});
 	}
 
 	void command_buffer_t::establish_execution_barrier(pipeline_stage aSrcStage, pipeline_stage aDstStage)
@@ -2974,59 +3502,426 @@ namespace avk
 	void command_buffer_t::end_render_pass()
 	{
 		mCommandBuffer->endRenderPass();
+		mCurrentRenderPass = vk::RenderPass{};
+		mCurrentFramebuffer = vk::Framebuffer{};
 	}
 
-	void command_buffer_t::bind_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, std::vector<descriptor_set> aDescriptorSets)
+#if VK_HEADER_VERSION >= 204
+	namespace
 	{
-		if (aDescriptorSets.size() == 0) {
-			AVK_LOG_WARNING("command_buffer_t::bind_descriptors has been called, but there are no descriptor sets to be bound.");
-			return;
+		// Stores the new value and returns true if it differs from the tracked one
+		template <typename V>
+		bool update_tracked_dynamic_state(std::optional<V>& aTracked, const V& aNewValue)
+		{
+			if (aTracked.has_value() && aTracked.value() == aNewValue) {
+				return false;
+			}
+			aTracked = aNewValue;
+			return true;
 		}
 
-		std::vector<vk::DescriptorSet> handles;
-		handles.reserve(aDescriptorSets.size());
-		for (const auto& dset : aDescriptorSets)
+		template <typename V>
+		bool update_tracked_dynamic_state(std::vector<std::optional<V>>& aTracked, uint32_t aIndex, const V& aNewValue)
 		{
-			handles.push_back(dset.handle());
+			if (aTracked.size() <= aIndex) {
+				aTracked.resize(aIndex + 1);
+			}
+			return update_tracked_dynamic_state(aTracked[aIndex], aNewValue);
 		}
+	}
 
-		if (aDescriptorSets.empty()) {
-			return;
+	void command_buffer_t::set_cull_mode(vk::CullModeFlags aCullMode, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mCullMode, aCullMode)) {
+			handle().setCullMode(aCullMode, aRoot.dispatch_loader_ext());
 		}
+	}
 
-		// Issue one or multiple bindDescriptorSets commands. We can only bind CONSECUTIVELY NUMBERED sets.
-		size_t descIdx = 0;
-		while (descIdx < aDescriptorSets.size()) {
-			const uint32_t setId = aDescriptorSets[descIdx].set_id();
-			uint32_t count = 1u;
-			while ((descIdx + count) < aDescriptorSets.size() && aDescriptorSets[descIdx + count].set_id() == (setId + count)) {
-				++count;
-			}
+	void command_buffer_t::set_front_face(vk::FrontFace aFrontFace, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mFrontFace, aFrontFace)) {
+			handle().setFrontFace(aFrontFace, aRoot.dispatch_loader_ext());
+		}
+	}
 
-			handle().bindDescriptorSets(
-				aBindingPoint,
-				aLayoutHandle,
-				setId, count,
-				&handles[descIdx],
-				0, // TODO: Dynamic offset count
-				nullptr); // TODO: Dynamic offset
+	void command_buffer_t::set_primitive_topology(vk::PrimitiveTopology aPrimitiveTopology, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mPrimitiveTopology, aPrimitiveTopology)) {
+			handle().setPrimitiveTopology(aPrimitiveTopology, aRoot.dispatch_loader_ext());
+		}
+	}
 
-			descIdx += count;
+	void command_buffer_t::set_depth_test_enable(bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mDepthTestEnable, aEnable)) {
+			handle().setDepthTestEnable(aEnable ? VK_TRUE : VK_FALSE, aRoot.dispatch_loader_ext());
 		}
 	}
 
-#if VK_HEADER_VERSION >= 135
-	void command_buffer_t::trace_rays(
-		vk::Extent3D aRaygenDimensions,
-		const shader_binding_table_ref& aShaderBindingTableRef,
-		const root& aRoot,
-#if VK_HEADER_VERSION >= 162
-		const vk::StridedDeviceAddressRegionKHR& aRaygenSbtRef,
-		const vk::StridedDeviceAddressRegionKHR& aRaymissSbtRef,
-		const vk::StridedDeviceAddressRegionKHR& aRayhitSbtRef,
-		const vk::StridedDeviceAddressRegionKHR& aCallableSbtRef
+	void command_buffer_t::set_depth_write_enable(bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mDepthWriteEnable, aEnable)) {
+			handle().setDepthWriteEnable(aEnable ? VK_TRUE : VK_FALSE, aRoot.dispatch_loader_ext());
+		}
+	}
 
-#else
+	void command_buffer_t::set_depth_compare_operation(vk::CompareOp aCompareOp, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mDepthCompareOp, aCompareOp)) {
+			handle().setDepthCompareOp(aCompareOp, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_depth_bounds_test_enable(bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mDepthBoundsTestEnable, aEnable)) {
+			handle().setDepthBoundsTestEnable(aEnable ? VK_TRUE : VK_FALSE, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_stencil_test_enable(bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mStencilTestEnable, aEnable)) {
+			handle().setStencilTestEnable(aEnable ? VK_TRUE : VK_FALSE, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_stencil_operation(vk::StencilFaceFlags aFaceMask, vk::StencilOp aFailOp, vk::StencilOp aPassOp, vk::StencilOp aDepthFailOp, vk::CompareOp aCompareOp, const root& aRoot)
+	{
+		const auto ops = std::make_tuple(aFailOp, aPassOp, aDepthFailOp, aCompareOp);
+		// Evaluate both faces, s.t. both tracked values are updated:
+		const bool frontChanged = has_flag(aFaceMask, vk::StencilFaceFlagBits::eFront) && update_tracked_dynamic_state(mDynamicStateValues.mStencilOp[0], ops);
+		const bool backChanged  = has_flag(aFaceMask, vk::StencilFaceFlagBits::eBack)  && update_tracked_dynamic_state(mDynamicStateValues.mStencilOp[1], ops);
+		if (frontChanged || backChanged) {
+			handle().setStencilOp(aFaceMask, aFailOp, aPassOp, aDepthFailOp, aCompareOp, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_rasterizer_discard_enable(bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mRasterizerDiscardEnable, aEnable)) {
+			handle().setRasterizerDiscardEnable(aEnable ? VK_TRUE : VK_FALSE, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_depth_bias_enable(bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mDepthBiasEnable, aEnable)) {
+			handle().setDepthBiasEnable(aEnable ? VK_TRUE : VK_FALSE, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_primitive_restart_enable(bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mPrimitiveRestartEnable, aEnable)) {
+			handle().setPrimitiveRestartEnable(aEnable ? VK_TRUE : VK_FALSE, aRoot.dispatch_loader_ext());
+		}
+	}
+
+#if VK_HEADER_VERSION >= 233
+	void command_buffer_t::set_polygon_mode(vk::PolygonMode aPolygonMode, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mPolygonMode, aPolygonMode)) {
+			handle().setPolygonModeEXT(aPolygonMode, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_depth_clamp_enable(bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mDepthClampEnable, aEnable)) {
+			handle().setDepthClampEnableEXT(aEnable ? VK_TRUE : VK_FALSE, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_color_blend_enable(uint32_t aAttachment, bool aEnable, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mColorBlendEnable, aAttachment, aEnable)) {
+			const vk::Bool32 enable = aEnable ? VK_TRUE : VK_FALSE;
+			handle().setColorBlendEnableEXT(aAttachment, enable, aRoot.dispatch_loader_ext());
+		}
+	}
+
+	void command_buffer_t::set_color_write_mask(uint32_t aAttachment, vk::ColorComponentFlags aColorWriteMask, const root& aRoot)
+	{
+		if (update_tracked_dynamic_state(mDynamicStateValues.mColorWriteMask, aAttachment, aColorWriteMask)) {
+			handle().setColorWriteMaskEXT(aAttachment, aColorWriteMask, aRoot.dispatch_loader_ext());
+		}
+	}
+#endif
+
+	void command_buffer_t::invalidate_dynamic_states_not_in(const std::vector<vk::DynamicState>& aDynamicStates)
+	{
+		auto isDynamic = [&aDynamicStates](vk::DynamicState aState) {
+			return std::end(aDynamicStates) != std::find(std::begin(aDynamicStates), std::end(aDynamicStates), aState);
+		};
+		auto& v = mDynamicStateValues;
+		if (!isDynamic(vk::DynamicState::eCullMode))				{ v.mCullMode.reset(); }
+		if (!isDynamic(vk::DynamicState::eFrontFace))				{ v.mFrontFace.reset(); }
+		if (!isDynamic(vk::DynamicState::ePrimitiveTopology))		{ v.mPrimitiveTopology.reset(); }
+		if (!isDynamic(vk::DynamicState::eDepthTestEnable))			{ v.mDepthTestEnable.reset(); }
+		if (!isDynamic(vk::DynamicState::eDepthWriteEnable))		{ v.mDepthWriteEnable.reset(); }
+		if (!isDynamic(vk::DynamicState::eDepthCompareOp))			{ v.mDepthCompareOp.reset(); }
+		if (!isDynamic(vk::DynamicState::eDepthBoundsTestEnable))	{ v.mDepthBoundsTestEnable.reset(); }
+		if (!isDynamic(vk::DynamicState::eStencilTestEnable))		{ v.mStencilTestEnable.reset(); }
+		if (!isDynamic(vk::DynamicState::eStencilOp))				{ v.mStencilOp = {}; }
+		if (!isDynamic(vk::DynamicState::eRasterizerDiscardEnable))	{ v.mRasterizerDiscardEnable.reset(); }
+		if (!isDynamic(vk::DynamicState::eDepthBiasEnable))			{ v.mDepthBiasEnable.reset(); }
+		if (!isDynamic(vk::DynamicState::ePrimitiveRestartEnable))	{ v.mPrimitiveRestartEnable.reset(); }
+#if VK_HEADER_VERSION >= 233
+		if (!isDynamic(vk::DynamicState::ePolygonModeEXT))			{ v.mPolygonMode.reset(); }
+		if (!isDynamic(vk::DynamicState::eDepthClampEnableEXT))		{ v.mDepthClampEnable.reset(); }
+		if (!isDynamic(vk::DynamicState::eColorBlendEnableEXT))		{ v.mColorBlendEnable.clear(); }
+		if (!isDynamic(vk::DynamicState::eColorWriteMaskEXT))		{ v.mColorWriteMask.clear(); }
+#endif
+	}
+#endif
+
+	namespace
+	{
+		size_t bind_point_index(vk::PipelineBindPoint aBindingPoint)
+		{
+			switch (aBindingPoint) {
+			case vk::PipelineBindPoint::eGraphics:
+				return 0;
+			case vk::PipelineBindPoint::eCompute:
+				return 1;
+			default:
+				return 2;
+			}
+		}
+
+		// Gathers pointers to the given bindings, ordered by set-id and binding-id. They are stored in aStack
+		// if they fit, in aHeap otherwise.
+		template <size_t N>
+		const binding_data** order_bindings(std::initializer_list<binding_data> aBindings, std::array<const binding_data*, N>& aStack, std::vector<const binding_data*>& aHeap)
+		{
+			const binding_data** ordered = aStack.data();
+			if (aBindings.size() > N) {
+				aHeap.resize(aBindings.size());
+				ordered = aHeap.data();
+			}
+			size_t i = 0;
+			for (auto& b : aBindings) {
+				ordered[i++] = &b;
+			}
+			std::sort(ordered, ordered + aBindings.size(), [](const binding_data* first, const binding_data* second) {
+				return *first < *second; // use operator<
+			});
+			return ordered;
+		}
+	}
+
+	void command_buffer_t::bind_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, std::vector<descriptor_set> aDescriptorSets)
+	{
+		// We don't know which layout aLayoutHandle refers to => can't reason about compatibility:
+		mBoundDescriptorSets[bind_point_index(aBindingPoint)] = {};
+		issue_bind_descriptor_sets(aBindingPoint, aLayoutHandle, aDescriptorSets);
+	}
+
+	command_buffer_t::bound_descriptor_sets& command_buffer_t::bound_descriptor_sets_for(vk::PipelineBindPoint aBindingPoint, const std::shared_ptr<const shared_pipeline_layout>& aLayout)
+	{
+		auto& bound = mBoundDescriptorSets[bind_point_index(aBindingPoint)];
+
+		// Sets which have been bound via a different layout remain bound only as far as that layout is compatible:
+		if (bound.mLayout != aLayout) {
+			const auto numCompatible = bound.mLayout ? bound.mLayout->number_of_compatible_sets(*aLayout) : 0u;
+			if (bound.mSets.size() > numCompatible) {
+				bound.mSets.resize(numCompatible);
+			}
+			bound.mLayout = aLayout;
+		}
+		return bound;
+	}
+
+	void command_buffer_t::bind_descriptors(vk::PipelineBindPoint aBindingPoint, const std::shared_ptr<const shared_pipeline_layout>& aLayout, std::vector<descriptor_set> aDescriptorSets)
+	{
+		auto& bound = bound_descriptor_sets_for(aBindingPoint, aLayout);
+
+		// Skip the sets which are bound already:
+		const auto numRequested = aDescriptorSets.size();
+		aDescriptorSets.erase(std::remove_if(std::begin(aDescriptorSets), std::end(aDescriptorSets), [&bound](const descriptor_set& aSet) {
+			return aSet.set_id() < bound.mSets.size() && bound.mSets[aSet.set_id()] == aSet.handle();
+		}), std::end(aDescriptorSets));
+		if (numRequested > 0 && aDescriptorSets.empty()) {
+			return;
+		}
+
+		for (const auto& dset : aDescriptorSets) {
+			if (dset.set_id() >= bound.mSets.size()) {
+				bound.mSets.resize(dset.set_id() + 1);
+			}
+			bound.mSets[dset.set_id()] = dset.handle();
+		}
+		issue_bind_descriptor_sets(aBindingPoint, aLayout->handle(), aDescriptorSets);
+	}
+
+	void command_buffer_t::push_descriptors(vk::PipelineBindPoint aBindingPoint, const std::shared_ptr<const shared_pipeline_layout>& aLayout, std::initializer_list<binding_data> aBindings, descriptor_cache& aFallbackCache, const root& aRoot)
+	{
+		auto& bound = bound_descriptor_sets_for(aBindingPoint, aLayout);
+
+		constexpr size_t maxBindingsOnStack = 32;
+		std::array<const binding_data*, maxBindingsOnStack> stackStorage;
+		std::vector<const binding_data*> heapStorage;
+		const auto n = aBindings.size();
+		const binding_data** orderedBindings = order_bindings(aBindings, stackStorage, heapStorage);
+
+		std::vector<binding_data> fallbackBindings;
+		std::array<vk::WriteDescriptorSet, maxBindingsOnStack> writes;
+		for (size_t begin = 0; begin < n;) {
+			size_t end = begin + 1;
+			while (end < n && orderedBindings[end]->mSetId == orderedBindings[begin]->mSetId) {
+				++end;
+			}
+			const auto setId = orderedBindings[begin]->mSetId;
+
+			if (!aLayout->is_push_descriptor_set(setId)) {
+				for (size_t i = begin; i < end; ++i) {
+					// The cache must not create push descriptor layouts:
+					fallbackBindings.push_back(*orderedBindings[i]);
+					fallbackBindings.back().mPushDescriptor = false;
+				}
+				begin = end;
+				continue;
+			}
+
+			bool direct = end - begin <= writes.size();
+			for (size_t i = begin; direct && i < end; ++i) {
+				direct = point_write_to_resource(*orderedBindings[i], writes[i - begin]);
+			}
+			if (direct) {
+				handle().pushDescriptorSetKHR(aBindingPoint, aLayout->handle(), setId, static_cast<uint32_t>(end - begin), writes.data(), aRoot.dispatch_loader_ext());
+			}
+			else {
+				// Arrays of resources have to be gathered into a prepared set first:
+				std::vector<binding_data> bindingsOfSet;
+				for (size_t i = begin; i < end; ++i) {
+					bindingsOfSet.push_back(*orderedBindings[i]);
+				}
+				const auto prepared = descriptor_set::prepare(std::begin(bindingsOfSet), std::end(bindingsOfSet));
+				handle().pushDescriptorSetKHR(aBindingPoint, aLayout->handle(), setId, static_cast<uint32_t>(prepared.number_of_writes()), &prepared.write_at(0), aRoot.dispatch_loader_ext());
+			}
+
+			// The pushed set replaces whatever has been bound at its set-id before:
+			if (setId < bound.mSets.size()) {
+				bound.mSets[setId] = vk::DescriptorSet{};
+			}
+			begin = end;
+		}
+
+		if (!fallbackBindings.empty()) {
+			std::vector<const binding_data*> fallbackPtrs;
+			for (const auto& b : fallbackBindings) {
+				fallbackPtrs.push_back(&b);
+			}
+			std::vector<descriptor_set> fallbackSets;
+			aFallbackCache.get_or_create_descriptor_sets(fallbackPtrs.data(), fallbackPtrs.size(), fallbackSets);
+			bind_descriptors(aBindingPoint, aLayout, std::move(fallbackSets));
+		}
+	}
+
+#if VK_HEADER_VERSION >= 235
+	void command_buffer_t::bind_descriptors(vk::PipelineBindPoint aBindingPoint, const std::shared_ptr<const shared_pipeline_layout>& aLayout, std::initializer_list<binding_data> aBindings, descriptor_buffer& aDescriptorBuffer)
+	{
+		const auto& dispatchLoader = aDescriptorBuffer.mRoot->dispatch_loader_ext();
+		if (mBoundDescriptorBuffer != aDescriptorBuffer.handle()) {
+			const auto bindingInfo = vk::DescriptorBufferBindingInfoEXT{}
+				.setAddress(aDescriptorBuffer.device_address())
+				.setUsage(aDescriptorBuffer.mBuffer->usage_flags());
+			handle().bindDescriptorBuffersEXT(1u, &bindingInfo, dispatchLoader);
+			mBoundDescriptorBuffer = aDescriptorBuffer.handle();
+		}
+		// Pipelines which use descriptor buffers can not use descriptor sets, i.e., none of the tracked sets remain usable:
+		mBoundDescriptorSets[bind_point_index(aBindingPoint)] = {};
+
+		constexpr size_t maxBindingsOnStack = 32;
+		std::array<const binding_data*, maxBindingsOnStack> stackStorage;
+		std::vector<const binding_data*> heapStorage;
+		const auto n = aBindings.size();
+		const binding_data** orderedBindings = order_bindings(aBindings, stackStorage, heapStorage);
+
+		// Offsets are set for runs of consecutive set-ids, all of which refer to the one bound buffer at index 0:
+		constexpr size_t maxSetsPerCall = 8;
+		const std::array<uint32_t, maxSetsPerCall> bufferIndices{};
+		std::array<vk::DeviceSize, maxSetsPerCall> offsets;
+		uint32_t firstSet = 0u;
+		uint32_t setCount = 0u;
+		auto flushOffsets = [&]() {
+			if (setCount > 0u) {
+				handle().setDescriptorBufferOffsetsEXT(aBindingPoint, aLayout->handle(), firstSet, setCount, bufferIndices.data(), offsets.data(), dispatchLoader);
+				setCount = 0u;
+			}
+		};
+
+		for (size_t begin = 0; begin < n;) {
+			size_t end = begin + 1;
+			while (end < n && orderedBindings[end]->mSetId == orderedBindings[begin]->mSetId) {
+				++end;
+			}
+			const auto setId = orderedBindings[begin]->mSetId;
+			if (setCount > 0u && (firstSet + setCount != setId || maxSetsPerCall == setCount)) {
+				flushOffsets();
+			}
+			if (0u == setCount) {
+				firstSet = setId;
+			}
+			offsets[setCount++] = aDescriptorBuffer.write_descriptor_set(*aLayout, setId, orderedBindings + begin, orderedBindings + end);
+			begin = end;
+		}
+		flushOffsets();
+	}
+#endif
+
+	void command_buffer_t::issue_bind_descriptor_sets(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, const std::vector<descriptor_set>& aDescriptorSets)
+	{
+		if (aDescriptorSets.size() == 0) {
+			AVK_LOG_WARNING("command_buffer_t::bind_descriptors has been called, but there are no descriptor sets to be bound.");
+			return;
+		}
+
+		std::vector<vk::DescriptorSet> handles;
+		handles.reserve(aDescriptorSets.size());
+		for (const auto& dset : aDescriptorSets)
+		{
+			handles.push_back(dset.handle());
+		}
+
+		if (aDescriptorSets.empty()) {
+			return;
+		}
+
+		// Issue one or multiple bindDescriptorSets commands. We can only bind CONSECUTIVELY NUMBERED sets.
+		size_t descIdx = 0;
+		while (descIdx < aDescriptorSets.size()) {
+			const uint32_t setId = aDescriptorSets[descIdx].set_id();
+			uint32_t count = 1u;
+			while ((descIdx + count) < aDescriptorSets.size() && aDescriptorSets[descIdx + count].set_id() == (setId + count)) {
+				++count;
+			}
+
+			handle().bindDescriptorSets(
+				aBindingPoint,
+				aLayoutHandle,
+				setId, count,
+				&handles[descIdx],
+				0, // TODO: Dynamic offset count
+				nullptr); // TODO: Dynamic offset
+
+			descIdx += count;
+		}
+	}
+
+#if VK_HEADER_VERSION >= 135
+	void command_buffer_t::trace_rays(
+		vk::Extent3D aRaygenDimensions,
+		const shader_binding_table_ref& aShaderBindingTableRef,
+		const root& aRoot,
+#if VK_HEADER_VERSION >= 162
+		const vk::StridedDeviceAddressRegionKHR& aRaygenSbtRef,
+		const vk::StridedDeviceAddressRegionKHR& aRaymissSbtRef,
+		const vk::StridedDeviceAddressRegionKHR& aRayhitSbtRef,
+		const vk::StridedDeviceAddressRegionKHR& aCallableSbtRef
+
+#else
 		const vk::StridedBufferRegionKHR& aRaygenSbtRef,
 		const vk::StridedBufferRegionKHR& aRaymissSbtRef,
 		const vk::StridedBufferRegionKHR& aRayhitSbtRef,
@@ -3045,9 +3940,215 @@ namespace avk
 #endif
 #pragma endregion
 
+#pragma region pipeline creation feedback definitions
+	namespace
+	{
+		std::chrono::nanoseconds elapsed_since(std::chrono::steady_clock::time_point aStart)
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - aStart);
+		}
+
+		// Invokes aFunc, adds the CPU wall time it took to aAccumulator, and returns aFunc's result
+		template <typename F>
+		auto timed(std::chrono::nanoseconds& aAccumulator, F&& aFunc)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			if constexpr (std::is_void_v<std::invoke_result_t<F>>) {
+				aFunc();
+				aAccumulator += elapsed_since(start);
+			}
+			else {
+				auto result = aFunc();
+				aAccumulator += elapsed_since(start);
+				return result;
+			}
+		}
+
+		// Storage for the driver feedback of one pipeline creation. mCreateInfo is to be added to the pipeline create info's pNext chain.
+		struct driver_feedback_request
+		{
+			explicit driver_feedback_request(uint32_t aNumberOfStages)
+				: mStageFeedbacks(aNumberOfStages)
+			{
+				mCreateInfo
+					.setPPipelineCreationFeedback(&mPipelineFeedback)
+					.setPipelineStageCreationFeedbackCount(aNumberOfStages)
+					.setPPipelineStageCreationFeedbacks(mStageFeedbacks.data());
+			}
+			driver_feedback_request(const driver_feedback_request&) = delete;
+			driver_feedback_request& operator=(const driver_feedback_request&) = delete;
+
+			vk::PipelineCreationFeedbackEXT mPipelineFeedback;
+			std::vector<vk::PipelineCreationFeedbackEXT> mStageFeedbacks;
+			vk::PipelineCreationFeedbackCreateInfoEXT mCreateInfo;
+		};
+
+		void apply_driver_feedback(pipeline_creation_feedback& aFeedback, const driver_feedback_request& aDriverFeedback, const std::vector<std::reference_wrapper<const shader>>& aShaders)
+		{
+			using flag_bits = vk::PipelineCreationFeedbackFlagBitsEXT;
+			const auto& pf = aDriverFeedback.mPipelineFeedback;
+			aFeedback.mDriverFeedbackValid = has_flag(pf.flags, flag_bits::eValid);
+			aFeedback.mApplicationPipelineCacheHit = has_flag(pf.flags, flag_bits::eApplicationPipelineCacheHit);
+			aFeedback.mBasePipelineAcceleration = has_flag(pf.flags, flag_bits::eBasePipelineAcceleration);
+			aFeedback.mDriverDuration = std::chrono::nanoseconds{ pf.duration };
+			aFeedback.mStages.clear();
+			for (size_t i = 0; i < aDriverFeedback.mStageFeedbacks.size() && i < aShaders.size(); ++i) {
+				const auto& sf = aDriverFeedback.mStageFeedbacks[i];
+				aFeedback.mStages.push_back(pipeline_creation_feedback::stage_feedback{
+					aShaders[i].get().info().mShaderType,
+					has_flag(sf.flags, flag_bits::eValid),
+					has_flag(sf.flags, flag_bits::eApplicationPipelineCacheHit),
+					std::chrono::nanoseconds{ sf.duration }
+				});
+			}
+		}
+
+		std::vector<std::reference_wrapper<const shader>> references_to(const std::vector<shader>& aShaders)
+		{
+			return std::vector<std::reference_wrapper<const shader>>(std::begin(aShaders), std::end(aShaders));
+		}
+
+		// Prepares the feedback for a creation in rewire_config_and_create_*. If the pipeline has been created before (e.g., it is
+		// created again after replace_render_pass_for_pipeline), its feedback has already been recorded. The new creation neither
+		// loads shaders nor creates set layouts, hence its feedback starts from scratch instead of adding to the previous one.
+		void begin_creation_feedback(pipeline_creation_feedback& aFeedback)
+		{
+			if (!aFeedback.mDescription.empty()) {
+				aFeedback = pipeline_creation_feedback{};
+			}
+		}
+
+		// Completes the feedback of a freshly created pipeline and adds it to the process-wide statistics
+		void finish_creation_feedback(pipeline_creation_feedback& aFeedback, const std::optional<driver_feedback_request>& aDriverFeedback, const std::vector<std::reference_wrapper<const shader>>& aShaders, std::string_view aPipelineType)
+		{
+			if (aDriverFeedback.has_value()) {
+				apply_driver_feedback(aFeedback, aDriverFeedback.value(), aShaders);
+			}
+			aFeedback.mDescription = std::string(aPipelineType) + " [";
+			for (size_t i = 0; i < aShaders.size(); ++i) {
+				aFeedback.mDescription += (0 == i ? "" : ", ") + aShaders[i].get().info().mPath;
+			}
+			aFeedback.mDescription += "]";
+			pipeline_creation_statistics::record(aFeedback);
+		}
+
+		// At most this many of the slowest pipelines are being tracked by pipeline_creation_statistics
+		constexpr size_t sMaxNumberOfSlowestPipelines = 32;
+
+		struct pipeline_creation_statistics_data
+		{
+			std::mutex mMutex;
+			pipeline_creation_report mReport;
+		};
+
+		pipeline_creation_statistics_data& get_pipeline_creation_statistics_data()
+		{
+			static pipeline_creation_statistics_data sData;
+			return sData;
+		}
+
+		std::atomic<bool> sPipelineCreationDriverFeedbackEnabled{ false };
+	}
+
+	void pipeline_creation_statistics::enable_driver_feedback(bool aEnable)
+	{
+		sPipelineCreationDriverFeedbackEnabled = aEnable;
+	}
+
+	bool pipeline_creation_statistics::is_driver_feedback_enabled()
+	{
+		return sPipelineCreationDriverFeedbackEnabled;
+	}
+
+	void pipeline_creation_statistics::record(const pipeline_creation_feedback& aFeedback)
+	{
+		auto& data = get_pipeline_creation_statistics_data();
+		std::scoped_lock guard(data.mMutex);
+		auto& r = data.mReport;
+		++r.mNumberOfPipelines;
+		if (aFeedback.mDriverFeedbackValid) {
+			++r.mNumberOfPipelinesWithDriverFeedback;
+			if (aFeedback.mApplicationPipelineCacheHit) {
+				++r.mNumberOfCacheHits;
+			}
+		}
+		r.mTotalShaderLoadDuration += aFeedback.mShaderLoadDuration;
+		r.mTotalLayoutCreationDuration += aFeedback.mLayoutCreationDuration;
+		r.mTotalPipelineCreationDuration += aFeedback.mPipelineCreationDuration;
+		r.mMaxPipelineCreationDuration = std::max(r.mMaxPipelineCreationDuration, aFeedback.mPipelineCreationDuration);
+
+		// Keep the slowest ones sorted in descending order:
+		const auto total = aFeedback.total_duration();
+		auto it = std::find_if(std::begin(r.mSlowestPipelines), std::end(r.mSlowestPipelines), [total](const pipeline_creation_feedback& aOther) {
+			return aOther.total_duration() < total;
+		});
+		if (r.mSlowestPipelines.size() < sMaxNumberOfSlowestPipelines || std::end(r.mSlowestPipelines) != it) {
+			r.mSlowestPipelines.insert(it, aFeedback);
+			if (r.mSlowestPipelines.size() > sMaxNumberOfSlowestPipelines) {
+				r.mSlowestPipelines.pop_back();
+			}
+		}
+	}
+
+	pipeline_creation_report pipeline_creation_statistics::report(size_t aNumberOfSlowest)
+	{
+		auto& data = get_pipeline_creation_statistics_data();
+		std::scoped_lock guard(data.mMutex);
+		pipeline_creation_report result = data.mReport;
+		if (result.mSlowestPipelines.size() > aNumberOfSlowest) {
+			result.mSlowestPipelines.resize(aNumberOfSlowest);
+		}
+		return result;
+	}
+
+	void pipeline_creation_statistics::reset()
+	{
+		auto& data = get_pipeline_creation_statistics_data();
+		std::scoped_lock guard(data.mMutex);
+		data.mReport = {};
+	}
+
+	std::string pipeline_creation_report::to_string() const
+	{
+		auto ms = [](std::chrono::nanoseconds aDuration) {
+			std::stringstream ss;
+			ss << std::fixed << std::setprecision(3) << std::chrono::duration<double, std::milli>(aDuration).count() << " ms";
+			return ss.str();
+		};
+
+		std::stringstream ss;
+		ss << "Pipeline creation report: " << mNumberOfPipelines << " pipelines\n";
+		ss << "  shader loading:    " << ms(mTotalShaderLoadDuration) << "\n";
+		ss << "  layout creation:   " << ms(mTotalLayoutCreationDuration) << "\n";
+		ss << "  pipeline creation: " << ms(mTotalPipelineCreationDuration) << " (max. " << ms(mMaxPipelineCreationDuration) << ")\n";
+		if (mNumberOfPipelinesWithDriverFeedback > 0) {
+			ss << "  cache hits:        " << mNumberOfCacheHits << " of " << mNumberOfPipelinesWithDriverFeedback << " with driver feedback ("
+			   << std::fixed << std::setprecision(1) << (cache_hit_rate() * 100.0) << "%)\n";
+		}
+		else {
+			ss << "  cache hits:        n/a (no driver feedback)\n";
+		}
+		if (!mSlowestPipelines.empty()) {
+			ss << "  slowest pipelines:\n";
+			for (const auto& fb : mSlowestPipelines) {
+				ss << "    " << ms(fb.total_duration()) << " " << fb.mDescription
+				   << " (shaders: " << ms(fb.mShaderLoadDuration)
+				   << ", layout: " << ms(fb.mLayoutCreationDuration)
+				   << ", pipeline: " << ms(fb.mPipelineCreationDuration);
+				if (fb.mDriverFeedbackValid) {
+					ss << ", driver: " << ms(fb.mDriverDuration) << (fb.mApplicationPipelineCacheHit ? ", cache hit" : ", cache miss");
+				}
+				ss << ")\n";
+			}
+		}
+		return ss.str();
+	}
+#pragma endregion
+
 #pragma region compute pipeline definitions
 	void root::rewire_config_and_create_compute_pipeline(compute_pipeline_t& aPreparedPipeline)
 	{
+		begin_creation_feedback(aPreparedPipeline.mCreationFeedback);
 		aPreparedPipeline.mShaderStageCreateInfo
 			.setModule(aPreparedPipeline.mShader.handle())
 			.setPName(aPreparedPipeline.mShader.info().mEntryPoint.c_str());
@@ -3061,8 +4162,11 @@ namespace avk
 
 		// Layout must already be configured and created properly!
 
-		// Create the PIPELINE LAYOUT
-		aPreparedPipeline.mPipelineLayout = device().createPipelineLayoutUnique(aPreparedPipeline.mPipelineLayoutCreateInfo, nullptr, dispatch_loader_core());
+		// Create the PIPELINE LAYOUT, or reuse an identical one
+		aPreparedPipeline.mPipelineLayout = timed(aPreparedPipeline.mCreationFeedback.mLayoutCreationDuration, [&] {
+			return global_layout_registry().get_or_create_pipeline_layout(device(), dispatch_loader_core(), aPreparedPipeline.mAllDescriptorSetLayouts, aPreparedPipeline.mPushConstantRanges, aPreparedPipeline.mPipelineLayoutCreateInfo.flags);
+		});
+		aPreparedPipeline.mPipelineLayoutCreateInfo = aPreparedPipeline.mPipelineLayout->create_info();
 		assert(static_cast<bool>(aPreparedPipeline.layout_handle()));
 
 		// Create the PIPELINE, a.k.a. putting it all together:
@@ -3072,12 +4176,20 @@ namespace avk
 			.setLayout(aPreparedPipeline.layout_handle())
 			.setBasePipelineHandle(nullptr) // Optional
 			.setBasePipelineIndex(-1); // Optional
+		std::optional<driver_feedback_request> driverFeedback;
+		if (pipeline_creation_statistics::is_driver_feedback_enabled()) {
+			driverFeedback.emplace(1u);
+			pipelineInfo.setPNext(&driverFeedback->mCreateInfo);
+		}
+		const auto pipelineCreationStart = std::chrono::steady_clock::now();
 #if VK_HEADER_VERSION >= 141
 		auto result = device().createComputePipelineUnique(nullptr, pipelineInfo, nullptr, dispatch_loader_core());
 		aPreparedPipeline.mPipeline = std::move(result.value);
 #else
 		aPreparedPipeline.mPipeline = device().createComputePipelineUnique(nullptr, pipelineInfo);
 #endif
+		aPreparedPipeline.mCreationFeedback.mPipelineCreationDuration += elapsed_since(pipelineCreationStart);
+		finish_creation_feedback(aPreparedPipeline.mCreationFeedback, driverFeedback, { std::cref(aPreparedPipeline.mShader) }, "compute");
 	}
 
 	compute_pipeline root::create_compute_pipeline(compute_pipeline_config aConfig, std::function<void(compute_pipeline_t&)> aAlterConfigBeforeCreation)
@@ -3089,7 +4201,7 @@ namespace avk
 			throw avk::logic_error("Shader missing in compute_pipeline_config! A compute pipeline can not be constructed without a shader.");
 		}
 		//    Compile the shader
-		result.mShader = create_shader(aConfig.mShaderInfo.value());
+		result.mShader = timed(result.mCreationFeedback.mShaderLoadDuration, [&] { return create_shader(aConfig.mShaderInfo.value()); });
 		assert(result.mShader.has_been_built());
 		//    Just fill in the create struct
 		result.mShaderStageCreateInfo = vk::PipelineShaderStageCreateInfo{}
@@ -3113,11 +4225,21 @@ namespace avk
 		if ((aConfig.mPipelineSettings & cfg::pipeline_settings::disable_optimization) == cfg::pipeline_settings::disable_optimization) {
 			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDisableOptimization;
 		}
+#if VK_HEADER_VERSION >= 235
+		if ((aConfig.mPipelineSettings & cfg::pipeline_settings::descriptor_buffer) == cfg::pipeline_settings::descriptor_buffer) {
+			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDescriptorBufferEXT;
+		}
+#endif
 
 		// 3. Compile the PIPELINE LAYOUT data and create-info
 		// Get the descriptor set layouts
 		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings));
-		allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts);
+#if VK_HEADER_VERSION >= 235
+		if (avk::has_flag(result.mPipelineCreateFlags, vk::PipelineCreateFlagBits::eDescriptorBufferEXT)) {
+			prepare_for_descriptor_buffers(result.mAllDescriptorSetLayouts);
+		}
+#endif
+		timed(result.mCreationFeedback.mLayoutCreationDuration, [&] { allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts); });
 
 		// Gather the push constant data
 		result.mPushConstantRanges.reserve(aConfig.mPushConstantsBindings.size()); // Important! Otherwise the vector might realloc and .data() will become invalid!
@@ -3150,11 +4272,11 @@ namespace avk
 	{
 		compute_pipeline_t result;
 		result.mPipelineCreateFlags			= aTemplate->mPipelineCreateFlags;
-		result.mShader						= create_shader_from_template(aTemplate->mShader);
+		result.mShader						= timed(result.mCreationFeedback.mShaderLoadDuration, [&] { return create_shader_from_template(aTemplate->mShader); });
 		result.mShaderStageCreateInfo		= aTemplate->mShaderStageCreateInfo;
 		result.mSpecializationInfo			= aTemplate->mSpecializationInfo;
 		result.mBasePipelineIndex			= aTemplate->mBasePipelineIndex;
-		result.mAllDescriptorSetLayouts		= create_set_of_descriptor_set_layouts_from_template(aTemplate->mAllDescriptorSetLayouts);
+		result.mAllDescriptorSetLayouts		= timed(result.mCreationFeedback.mLayoutCreationDuration, [&] { return create_set_of_descriptor_set_layouts_from_template(aTemplate->mAllDescriptorSetLayouts); });
 		result.mPushConstantRanges			= aTemplate->mPushConstantRanges;
 		result.mPipelineLayoutCreateInfo	= aTemplate->mPipelineLayoutCreateInfo;
 
@@ -3230,7 +4352,7 @@ namespace avk
 #pragma endregion
 
 #pragma region descriptor pool definitions
-	descriptor_pool root::create_descriptor_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets)
+	descriptor_pool root::create_descriptor_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets, vk::DescriptorPoolCreateFlags aFlags)
 	{
 		descriptor_pool result;
 		result.mInitialCapacities = aSizeRequirements;
@@ -3243,7 +4365,7 @@ namespace avk
 			.setPoolSizeCount(static_cast<uint32_t>(result.mInitialCapacities.size()))
 			.setPPoolSizes(result.mInitialCapacities.data())
 			.setMaxSets(aNumSets)
-			.setFlags(vk::DescriptorPoolCreateFlags()); // The structure has an optional flag similar to command pools that determines if individual descriptor sets can be freed or not: VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT. We're not going to touch the descriptor set after creating it, so we don't need this flag. [10]
+			.setFlags(aFlags); // The structure has an optional flag similar to command pools that determines if individual descriptor sets can be freed or not: VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT. We're not going to touch the descriptor set after creating it, so we don't need this flag. [10]
 		result.mDescriptorPool = aDevice.createDescriptorPoolUnique(createInfo, nullptr, aDispatchLoader);
 
 		AVK_LOG_DEBUG("Allocated pool with flags[" + vk::to_string(createInfo.flags) + "], maxSets[" + std::to_string(createInfo.maxSets) + "], remaining-sets[" + std::to_string(result.mNumRemainingSets) + "], size-entries[" + std::to_string(createInfo.poolSizeCount) + "]");
@@ -3256,9 +4378,9 @@ namespace avk
 		return result;
 	}
 
-	descriptor_pool root::create_descriptor_pool(const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets)
+	descriptor_pool root::create_descriptor_pool(const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets, vk::DescriptorPoolCreateFlags aFlags)
 	{
-		return create_descriptor_pool(device(), dispatch_loader_core(), aSizeRequirements, aNumSets);
+		return create_descriptor_pool(device(), dispatch_loader_core(), aSizeRequirements, aNumSets, aFlags);
 	}
 
 	bool descriptor_pool::has_capacity_for(const descriptor_alloc_request& pRequest) const
@@ -3289,7 +4411,7 @@ namespace avk
 				h++;
 				continue;
 			}
-			if (needType == haveType && weNeed[n].descriptorCount <= weHave[n].descriptorCount) {
+			if (needType == haveType && weNeed[n].descriptorCount <= weHave[h].descriptorCount) {
 				n++;
 				h++;
 				continue;
@@ -3335,10 +4457,38 @@ namespace avk
 
 		assert(mDescriptorPool);
 		auto result = mDescriptorPool.getOwner().allocateDescriptorSets(allocInfo);
+		consume_capacities_for(aLayouts);
+		return result;
+	}
 
-		// Update the pool's stats:
-		for (const descriptor_set_layout& dsl : aLayouts) {
-			for (const auto& dps : dsl.required_pool_sizes()) {
+	vk::Result descriptor_pool::try_allocate(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts, std::vector<vk::DescriptorSet>& aResult)
+	{
+		std::vector<vk::DescriptorSetLayout> setLayouts;
+		setLayouts.reserve(aLayouts.size());
+		for (auto& in : aLayouts) {
+			setLayouts.emplace_back(in.get().handle());
+		}
+
+		auto allocInfo = vk::DescriptorSetAllocateInfo()
+			.setDescriptorPool(mDescriptorPool.get())
+			.setDescriptorSetCount(static_cast<uint32_t>(setLayouts.size()))
+			.setPSetLayouts(setLayouts.data());
+
+		assert(mDescriptorPool);
+		aResult.resize(setLayouts.size());
+		const auto result = mDescriptorPool.getOwner().allocateDescriptorSets(&allocInfo, aResult.data());
+		if (vk::Result::eSuccess != result) {
+			aResult.clear();
+			return result;
+		}
+		consume_capacities_for(aLayouts);
+		return result;
+	}
+
+	void descriptor_pool::consume_capacities_for(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts)
+	{
+		for (const descriptor_set_layout& dsl : aLayouts) {
+			for (const auto& dps : dsl.required_pool_sizes()) {
 				auto it = std::find_if(std::begin(mRemainingCapacities), std::end(mRemainingCapacities), [&dps](vk::DescriptorPoolSize& el){
 					return el.type == dps.type;
 				});
@@ -3352,8 +4502,6 @@ namespace avk
 		}
 
 		mNumRemainingSets -= static_cast<int>(aLayouts.size());
-
-		return result;
 	}
 
 	void descriptor_pool::reset()
@@ -3375,6 +4523,107 @@ namespace avk
 		result.mRoot = this;
 		return result;
 	}
+
+	descriptor_ring root::create_descriptor_ring(uint32_t aFramesInFlight, uint32_t aSetsPerPool, std::string aName)
+	{
+		if (0u == aFramesInFlight || 0u == aSetsPerPool) {
+			throw avk::runtime_error("A descriptor ring needs at least one frame in flight and at least one set per pool.");
+		}
+		if (aName.empty()) {
+			static int sDescRingId = 1;
+			aName = "Descriptor Ring #" + std::to_string(sDescRingId++);
+		}
+
+		descriptor_ring result;
+		result.mName = std::move(aName);
+		result.mRoot = this;
+		result.mSetsPerPool = aSetsPerPool;
+		result.mFrames.resize(aFramesInFlight);
+		return result;
+	}
+
+	bindless_table root::create_bindless_table(uint32_t aSetId, uint32_t aMaxImages, uint32_t aMaxBuffers, uint32_t aMaxSamplers, uint32_t aFramesInFlight, shader_type aShaderStages)
+	{
+		if (0u == aFramesInFlight || 0u == aMaxImages || 0u == aMaxBuffers || 0u == aMaxSamplers) {
+			throw avk::runtime_error("A bindless table needs at least one frame in flight and at least one slot per array.");
+		}
+
+		// The arrays must fit into the device's update-after-bind limits:
+		vk::PhysicalDeviceDescriptorIndexingProperties indexingProps;
+		vk::PhysicalDeviceProperties2 props2;
+		props2.pNext = &indexingProps;
+		physical_device().getProperties2(&props2);
+		if (aMaxImages > std::min(indexingProps.maxDescriptorSetUpdateAfterBindSampledImages, indexingProps.maxPerStageDescriptorUpdateAfterBindSampledImages)
+			|| aMaxBuffers > std::min(indexingProps.maxDescriptorSetUpdateAfterBindStorageBuffers, indexingProps.maxPerStageDescriptorUpdateAfterBindStorageBuffers)
+			|| aMaxSamplers > std::min(indexingProps.maxDescriptorSetUpdateAfterBindSamplers, indexingProps.maxPerStageDescriptorUpdateAfterBindSamplers)) {
+			throw avk::runtime_error("The requested bindless table sizes exceed the device's update-after-bind descriptor limits.");
+		}
+
+		const auto flags = vk::DescriptorBindingFlagBits::eUpdateAfterBind | vk::DescriptorBindingFlagBits::ePartiallyBound | vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending;
+		const auto stages = to_vk_shader_stages(aShaderStages);
+		std::vector<binding_data> bindings{
+			binding_data{ aSetId, vk::DescriptorSetLayoutBinding{ bindless_table::image_binding_id,   vk::DescriptorType::eSampledImage,  aMaxImages,   stages }, {}, flags },
+			binding_data{ aSetId, vk::DescriptorSetLayoutBinding{ bindless_table::buffer_binding_id,  vk::DescriptorType::eStorageBuffer, aMaxBuffers,  stages }, {}, flags },
+			binding_data{ aSetId, vk::DescriptorSetLayoutBinding{ bindless_table::sampler_binding_id, vk::DescriptorType::eSampler,       aMaxSamplers, stages }, {}, flags }
+		};
+
+		bindless_table result;
+		result.mRoot = this;
+		result.mSetId = aSetId;
+		result.mFramesInFlight = aFramesInFlight;
+		result.mLayout = descriptor_set_layout::prepare(std::move(bindings));
+		allocate_descriptor_set_layout(result.mLayout);
+
+		// The one and only set of the table. Its pool must support update-after-bind, too:
+		auto pool = std::make_shared<descriptor_pool>(create_descriptor_pool(result.mLayout.required_pool_sizes(), 1, vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind));
+		auto setHandles = pool->allocate({ std::cref(result.mLayout) });
+		result.mDescriptorSet.set_set_id(aSetId);
+		result.mDescriptorSet.link_to_handle_and_pool(setHandles.front(), std::move(pool));
+
+		result.mImageSlots.mCapacity = aMaxImages;
+		result.mBufferSlots.mCapacity = aMaxBuffers;
+		result.mSamplerSlots.mCapacity = aMaxSamplers;
+		result.mMutex = std::make_unique<std::mutex>();
+		return result;
+	}
+
+#if VK_HEADER_VERSION >= 235
+	descriptor_buffer root::create_descriptor_buffer(uint32_t aFramesInFlight, vk::DeviceSize aBytesPerFrame, bool aRobustBufferAccess)
+	{
+		if (0u == aFramesInFlight || 0u == aBytesPerFrame) {
+			throw avk::runtime_error("A descriptor buffer needs at least one frame in flight and a non-zero size per frame.");
+		}
+
+		descriptor_buffer result;
+		result.mRoot = this;
+		vk::PhysicalDeviceProperties2 props2;
+		props2.pNext = &result.mProperties;
+		physical_device().getProperties2(&props2);
+		result.mProperties.pNext = nullptr;
+		result.mRobustBufferAccess = aRobustBufferAccess;
+		result.mFramesInFlight = aFramesInFlight;
+
+		// Each frame's region must start at a valid set offset:
+		const auto alignment = result.mProperties.descriptorBufferOffsetAlignment;
+		result.mBytesPerFrame = (aBytesPerFrame + alignment - 1) / alignment * alignment;
+		// The buffer holds resource and sampler descriptors, i.e., all of its offsets must be within both ranges:
+		const auto totalSize = result.mBytesPerFrame * aFramesInFlight;
+		if (totalSize > std::min(result.mProperties.maxResourceDescriptorBufferRange, result.mProperties.maxSamplerDescriptorBufferRange)) {
+			throw avk::runtime_error("The requested descriptor buffer size exceeds the device's maximum descriptor buffer range.");
+		}
+
+		result.mBuffer = create_buffer(
+			memory_usage::host_coherent,
+			vk::BufferUsageFlagBits::eResourceDescriptorBufferEXT | vk::BufferUsageFlagBits::eSamplerDescriptorBufferEXT | vk::BufferUsageFlagBits::eShaderDeviceAddress,
+			generic_buffer_meta::create_from_size(static_cast<size_t>(totalSize))
+		);
+		// The mapping refers to the buffer's memory handle, which must therefore not move along with the descriptor_buffer:
+		result.mBuffer.enable_shared_ownership();
+		result.mMapping.emplace(result.mBuffer->map_memory(mapping_access::write));
+		result.mMappedData = static_cast<std::byte*>(result.mMapping->get());
+		return result;
+	}
+#endif
 #pragma endregion
 
 #pragma region descriptor set layout definitions
@@ -3385,11 +4634,11 @@ namespace avk
 			return false;
 		}
 		for (size_t i = 0; i < n; ++i) {
-			if (left.mOrderedBindings[i] != right.mOrderedBindings[i]) {
+			if (left.mOrderedBindings[i] != right.mOrderedBindings[i] || left.mOrderedBindingFlags[i] != right.mOrderedBindingFlags[i]) {
 				return false;
 			}
 		}
-		return true;
+		return left.mCreateFlags == right.mCreateFlags;
 	}
 
 	bool operator !=(const descriptor_set_layout& left, const descriptor_set_layout& right) {
@@ -3399,11 +4648,12 @@ namespace avk
 	void root::allocate_descriptor_set_layout(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, descriptor_set_layout& aLayoutToBeAllocated)
 	{
 		if (!aLayoutToBeAllocated.mLayout) {
-			// Allocate the layout and return the result:
-			auto createInfo = vk::DescriptorSetLayoutCreateInfo()
-				.setBindingCount(static_cast<uint32_t>(aLayoutToBeAllocated.mOrderedBindings.size()))
-				.setPBindings(aLayoutToBeAllocated.mOrderedBindings.data());
-			aLayoutToBeAllocated.mLayout = aDevice.createDescriptorSetLayoutUnique(createInfo, nullptr, aDispatchLoader);
+			// Without VK_KHR_push_descriptor, sets which have been marked for push descriptors become ordinary ones:
+			if (aLayoutToBeAllocated.is_push_descriptor() && !supports_push_descriptors(aDevice)) {
+				aLayoutToBeAllocated.mCreateFlags &= ~vk::DescriptorSetLayoutCreateFlags{ vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR };
+			}
+			// Get the layout from the registry, which only creates it if there is no identical one yet:
+			aLayoutToBeAllocated.mLayout = global_layout_registry().get_or_create_descriptor_set_layout(aDevice, aDispatchLoader, aLayoutToBeAllocated.mOrderedBindings, aLayoutToBeAllocated.mOrderedBindingFlags, aLayoutToBeAllocated.mCreateFlags);
 		}
 		else {
 			AVK_LOG_ERROR("descriptor_set_layout's handle already has a value => it most likely has already been allocated. Won't do it again.");
@@ -3415,11 +4665,44 @@ namespace avk
 		return allocate_descriptor_set_layout(device(), dispatch_loader_core(), aLayoutToBeAllocated);
 	}
 
+	bool root::supports_push_descriptors(vk::Device aDevice)
+	{
+		return is_device_extension_enabled(aDevice, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+	}
+
+	void root::allocate_descriptor_update_template(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, descriptor_set_layout& aLayout)
+	{
+		assert(aLayout.has_handle());
+		std::vector<vk::DescriptorUpdateTemplateEntry> entries;
+		size_t offset = 0;
+		for (const auto& b : aLayout.mOrderedBindings) {
+			const auto stride = descriptor_set::payload_stride(b.descriptorType);
+			if (0 == stride || 0u == b.descriptorCount) {
+				// Can not be written from the payload => sets of this layout are written via vkUpdateDescriptorSets
+				return;
+			}
+			entries.emplace_back(b.binding, 0u, b.descriptorCount, b.descriptorType, offset, stride);
+			offset += descriptor_set::payload_size(b.descriptorType, b.descriptorCount);
+		}
+		if (entries.empty()) {
+			return;
+		}
+
+		auto createInfo = vk::DescriptorUpdateTemplateCreateInfo{}
+			.setDescriptorUpdateEntryCount(static_cast<uint32_t>(entries.size()))
+			.setPDescriptorUpdateEntries(entries.data())
+			.setTemplateType(vk::DescriptorUpdateTemplateType::eDescriptorSet)
+			.setDescriptorSetLayout(aLayout.handle());
+		aLayout.mUpdateTemplate = aDevice.createDescriptorUpdateTemplateUnique(createInfo, nullptr, aDispatchLoader);
+	}
+
 	descriptor_set_layout root::create_descriptor_set_layout_from_template(const descriptor_set_layout& aTemplate)
 	{
 		descriptor_set_layout result;
 		result.mBindingRequirements = aTemplate.mBindingRequirements;
 		result.mOrderedBindings = aTemplate.mOrderedBindings;
+		result.mOrderedBindingFlags = aTemplate.mOrderedBindingFlags;
+		result.mCreateFlags = aTemplate.mCreateFlags;
 		allocate_descriptor_set_layout(result);
 		return result;
 	}
@@ -3497,6 +4780,19 @@ namespace avk
 		return result;
 	}
 
+#if VK_HEADER_VERSION >= 235
+	void root::prepare_for_descriptor_buffers(set_of_descriptor_set_layouts& aLayouts)
+	{
+		for (auto& dsl : aLayouts.mLayouts) {
+			assert(!dsl.has_handle());
+			if (dsl.is_push_descriptor()) {
+				throw avk::logic_error("Push descriptors can not be combined with descriptor buffers. Remove avk::push_descriptor from the pipeline's bindings.");
+			}
+			dsl.mCreateFlags |= vk::DescriptorSetLayoutCreateFlagBits::eDescriptorBufferEXT;
+		}
+	}
+#endif
+
 	std::vector<vk::DescriptorSetLayout> set_of_descriptor_set_layouts::layout_handles() const
 	{
 		std::vector<vk::DescriptorSetLayout> allHandles;
@@ -3508,42 +4804,364 @@ namespace avk
 	}
 #pragma endregion
 
+#pragma region layout registry definitions
+	namespace
+	{
+		template <typename H>
+		uint64_t handle_key_word(H aHandle)
+		{
+			const auto cHandle = static_cast<typename H::CType>(aHandle);
+			if constexpr (std::is_pointer_v<decltype(cHandle)>) {
+				return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(cHandle));
+			}
+			else {
+				return static_cast<uint64_t>(cHandle);
+			}
+		}
+	}
+
+	vk::PipelineLayoutCreateInfo shared_pipeline_layout::create_info() const
+	{
+		return vk::PipelineLayoutCreateInfo{}
+			.setFlags(mFlags)
+			.setSetLayoutCount(static_cast<uint32_t>(mSetLayoutHandles.size()))
+			.setPSetLayouts(mSetLayoutHandles.data())
+			.setPushConstantRangeCount(static_cast<uint32_t>(mPushConstantRanges.size()))
+			.setPPushConstantRanges(mPushConstantRanges.data());
+	}
+
+	uint32_t shared_pipeline_layout::number_of_compatible_sets(const shared_pipeline_layout& aOther) const
+	{
+		if (this == &aOther) {
+			return static_cast<uint32_t>(mSetLayoutHandles.size());
+		}
+		// Layouts are only compatible for any set if their push constant ranges are identical:
+		if (mFlags != aOther.mFlags || mPushConstantRanges != aOther.mPushConstantRanges) {
+			return 0u;
+		}
+		// Identically defined descriptor set layouts have identical handles, because they come from the registry:
+		const auto n = std::min(mSetLayoutHandles.size(), aOther.mSetLayoutHandles.size());
+		uint32_t i = 0;
+		while (i < n && mSetLayoutHandles[i] == aOther.mSetLayoutHandles[i]) {
+			++i;
+		}
+		return i;
+	}
+
+	size_t layout_registry::key_hash::operator()(const std::vector<uint64_t>& aKey) const
+	{
+		size_t h = aKey.size();
+		for (auto word : aKey) {
+			hash_combine(h, word);
+		}
+		return h;
+	}
+
+	layout_registry::descriptor_set_layout_handle layout_registry::get_or_create_descriptor_set_layout(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorSetLayoutBinding>& aOrderedBindings, const std::vector<vk::DescriptorBindingFlags>& aOrderedBindingFlags, vk::DescriptorSetLayoutCreateFlags aFlags)
+	{
+		assert(aOrderedBindingFlags.empty() || aOrderedBindingFlags.size() == aOrderedBindings.size());
+		const bool anyBindingFlags = std::any_of(std::begin(aOrderedBindingFlags), std::end(aOrderedBindingFlags), [](vk::DescriptorBindingFlags aFlags) { return static_cast<bool>(aFlags); });
+
+		std::vector<uint64_t> key;
+		key.reserve(2 + aOrderedBindings.size() * 5);
+		key.push_back(handle_key_word(aDevice));
+		key.push_back(static_cast<VkDescriptorSetLayoutCreateFlags>(aFlags));
+		for (size_t i = 0; i < aOrderedBindings.size(); ++i) {
+			const auto& b = aOrderedBindings[i];
+			key.push_back(b.binding);
+			key.push_back(static_cast<uint64_t>(b.descriptorType));
+			key.push_back(b.descriptorCount);
+			key.push_back(static_cast<VkShaderStageFlags>(b.stageFlags));
+			// Immutable samplers are compared by their handles, not by the address of the array:
+			if (nullptr != b.pImmutableSamplers) {
+				for (uint32_t j = 0; j < b.descriptorCount; ++j) {
+					key.push_back(handle_key_word(b.pImmutableSamplers[j]));
+				}
+			}
+			key.push_back(anyBindingFlags ? static_cast<VkDescriptorBindingFlags>(aOrderedBindingFlags[i]) : 0u);
+		}
+
+		std::scoped_lock guard(mMutex);
+		auto& entry = mDescriptorSetLayouts[std::move(key)];
+		if (auto existing = entry.lock()) {
+			++mNumberOfReuses;
+			return existing;
+		}
+
+		auto createInfo = vk::DescriptorSetLayoutCreateInfo()
+			.setFlags(aFlags)
+			.setBindingCount(static_cast<uint32_t>(aOrderedBindings.size()))
+			.setPBindings(aOrderedBindings.data());
+		auto bindingFlagsInfo = vk::DescriptorSetLayoutBindingFlagsCreateInfo{}
+			.setBindingCount(static_cast<uint32_t>(aOrderedBindingFlags.size()))
+			.setPBindingFlags(aOrderedBindingFlags.data());
+		if (anyBindingFlags) {
+			createInfo.setPNext(&bindingFlagsInfo);
+			for (auto flags : aOrderedBindingFlags) {
+				if (flags & vk::DescriptorBindingFlagBits::eUpdateAfterBind) {
+					createInfo.flags |= vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool;
+				}
+			}
+		}
+		auto result = std::make_shared<vk::UniqueHandle<vk::DescriptorSetLayout, DISPATCH_LOADER_CORE_TYPE>>(aDevice.createDescriptorSetLayoutUnique(createInfo, nullptr, aDispatchLoader));
+		entry = result;
+		if (++mInsertionsSinceCleanup > mDescriptorSetLayouts.size() + mPipelineLayouts.size()) {
+			remove_expired_entries_locked();
+		}
+		return result;
+	}
+
+	std::shared_ptr<const shared_pipeline_layout> layout_registry::get_or_create_pipeline_layout(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const set_of_descriptor_set_layouts& aSetLayouts, const std::vector<vk::PushConstantRange>& aPushConstantRanges, vk::PipelineLayoutCreateFlags aFlags)
+	{
+		std::vector<uint64_t> key;
+		key.reserve(3 + aSetLayouts.number_of_sets() + aPushConstantRanges.size() * 3);
+		key.push_back(handle_key_word(aDevice));
+		key.push_back(static_cast<VkPipelineLayoutCreateFlags>(aFlags));
+		key.push_back(aSetLayouts.number_of_sets());
+		for (const auto& dsl : aSetLayouts.all_sets()) {
+			if (!dsl.has_handle()) {
+				throw avk::runtime_error("The descriptor set layouts must be allocated before a pipeline layout can be created from them.");
+			}
+			key.push_back(handle_key_word(dsl.handle()));
+		}
+		for (const auto& pcr : aPushConstantRanges) {
+			key.push_back(static_cast<VkShaderStageFlags>(pcr.stageFlags));
+			key.push_back(pcr.offset);
+			key.push_back(pcr.size);
+		}
+
+		std::scoped_lock guard(mMutex);
+		auto& entry = mPipelineLayouts[std::move(key)];
+		if (auto existing = entry.lock()) {
+			++mNumberOfReuses;
+			return existing;
+		}
+
+		auto layout = std::make_shared<shared_pipeline_layout>();
+		layout->mFlags = aFlags;
+		layout->mPushConstantRanges = aPushConstantRanges;
+		for (const auto& dsl : aSetLayouts.all_sets()) {
+			layout->mSetLayoutHandles.push_back(dsl.handle());
+			layout->mSetLayoutCreateFlags.push_back(dsl.create_flags());
+			layout->mSetLayouts.push_back(dsl.shared_handle());
+		}
+		layout->mPipelineLayout = aDevice.createPipelineLayoutUnique(layout->create_info(), nullptr, aDispatchLoader);
+		std::shared_ptr<const shared_pipeline_layout> result = std::move(layout);
+		entry = result;
+		if (++mInsertionsSinceCleanup > mDescriptorSetLayouts.size() + mPipelineLayouts.size()) {
+			remove_expired_entries_locked();
+		}
+		return result;
+	}
+
+	size_t layout_registry::number_of_descriptor_set_layouts() const
+	{
+		std::scoped_lock guard(mMutex);
+		return static_cast<size_t>(std::count_if(std::begin(mDescriptorSetLayouts), std::end(mDescriptorSetLayouts), [](const auto& aEntry) { return !aEntry.second.expired(); }));
+	}
+
+	size_t layout_registry::number_of_pipeline_layouts() const
+	{
+		std::scoped_lock guard(mMutex);
+		return static_cast<size_t>(std::count_if(std::begin(mPipelineLayouts), std::end(mPipelineLayouts), [](const auto& aEntry) { return !aEntry.second.expired(); }));
+	}
+
+	void layout_registry::remove_expired_entries()
+	{
+		std::scoped_lock guard(mMutex);
+		remove_expired_entries_locked();
+	}
+
+	void layout_registry::remove_expired_entries_locked()
+	{
+		for (auto it = std::begin(mDescriptorSetLayouts); it != std::end(mDescriptorSetLayouts);) {
+			it = it->second.expired() ? mDescriptorSetLayouts.erase(it) : std::next(it);
+		}
+		for (auto it = std::begin(mPipelineLayouts); it != std::end(mPipelineLayouts);) {
+			it = it->second.expired() ? mPipelineLayouts.erase(it) : std::next(it);
+		}
+		mInsertionsSinceCleanup = 0;
+	}
+
+	layout_registry& root::global_layout_registry()
+	{
+		static layout_registry sRegistry;
+		return sRegistry;
+	}
+#pragma endregion
+
 #pragma region standard descriptor set
 
+	uint64_t descriptor_cache::next_id()
+	{
+		static std::atomic<uint64_t> sNextId{ 1 };
+		return sNextId++;
+	}
+
+	descriptor_cache::pool_list& descriptor_cache::pools_of_this_thread()
+	{
+		// The pool list this thread has used most recently. Pool lists live as long as their cache,
+		// and cache ids are never reused => this is valid whenever the id matches.
+		thread_local uint64_t tCacheId = 0;
+		thread_local pool_list* tPools = nullptr;
+		if (mId == tCacheId) {
+			return *tPools;
+		}
+
+		const auto tId = std::this_thread::get_id();
+		pool_list* pools = nullptr;
+		{
+			std::shared_lock lock(mState->mPoolListsMutex);
+			const auto it = mState->mPoolLists.find(tId);
+			if (std::end(mState->mPoolLists) != it) {
+				pools = it->second.get();
+			}
+		}
+		if (nullptr == pools) {
+			std::unique_lock lock(mState->mPoolListsMutex);
+			auto& entry = mState->mPoolLists[tId];
+			entry = std::make_unique<pool_list>();
+			pools = entry.get();
+		}
+
+		tCacheId = mId;
+		tPools = pools;
+		return *pools;
+	}
+
+	template <typename F>
+	void descriptor_cache::for_each_handle_key(const descriptor_set& aSet, F&& aFunc)
+	{
+		const auto n = aSet.number_of_writes();
+		for (size_t i = 0; i < n; ++i) {
+			const auto& w = aSet.write_at(i);
+			for (uint32_t di = 0; di < w.descriptorCount; ++di) {
+				if (nullptr != w.pImageInfo) {
+					if (w.pImageInfo[di].imageView) {
+						aFunc(key_of(w.pImageInfo[di].imageView));
+					}
+					if (w.pImageInfo[di].sampler) {
+						aFunc(key_of(w.pImageInfo[di].sampler));
+					}
+				}
+				if (nullptr != w.pBufferInfo && w.pBufferInfo[di].buffer) {
+					aFunc(key_of(w.pBufferInfo[di].buffer));
+				}
+				if (nullptr != w.pTexelBufferView && w.pTexelBufferView[di]) {
+					aFunc(key_of(w.pTexelBufferView[di]));
+				}
+			}
+		}
+	}
+
+	void descriptor_cache::index_set(shard& aShard, const descriptor_set& aSet)
+	{
+		for_each_handle_key(aSet, [&aShard, &aSet](const handle_key& aKey) {
+			aShard.mSetsByHandle.emplace(aKey, &aSet);
+		});
+	}
+
+	void descriptor_cache::erase_set(shard& aShard, const descriptor_set* aSet)
+	{
+		// Remove exactly one index entry per reference, as they have been added in index_set:
+		for_each_handle_key(*aSet, [&aShard, aSet](const handle_key& aKey) {
+			auto [first, last] = aShard.mSetsByHandle.equal_range(aKey);
+			for (auto it = first; it != last; ++it) {
+				if (it->second == aSet) {
+					aShard.mSetsByHandle.erase(it);
+					break;
+				}
+			}
+		});
+
+		auto [first, last] = aShard.mSets.equal_range(aSet->content_hash());
+		for (auto it = first; it != last; ++it) {
+			if (&it->second.mSet == aSet) {
+				aShard.mSets.erase(it);
+				return;
+			}
+		}
+		assert(false); // The set must be stored in this shard
+	}
+
 	const descriptor_set_layout& descriptor_cache::get_or_alloc_layout(descriptor_set_layout aPreparedLayout)
 	{
-		const auto it = mLayouts.find(aPreparedLayout);
-		if (mLayouts.end() != it) {
-			assert(it->handle());
-			return *it;
+		const auto hash = std::hash<descriptor_set_layout>{}(aPreparedLayout);
+		auto& s = shard_for(hash);
+		{
+			std::shared_lock lock(s.mMutex);
+			const auto [first, last] = s.mLayouts.equal_range(hash);
+			for (auto it = first; it != last; ++it) {
+				if (it->second == aPreparedLayout) {
+					assert(it->second.handle());
+					return it->second;
+				}
+			}
+		}
+
+		std::unique_lock lock(s.mMutex);
+		// Another thread might have inserted it in the meantime:
+		const auto [first, last] = s.mLayouts.equal_range(hash);
+		for (auto it = first; it != last; ++it) {
+			if (it->second == aPreparedLayout) {
+				return it->second;
+			}
 		}
 
 		root::allocate_descriptor_set_layout(mRoot->device(), mRoot->dispatch_loader_core(), aPreparedLayout);
+		root::allocate_descriptor_update_template(mRoot->device(), mRoot->dispatch_loader_core(), aPreparedLayout);
 
-		const auto result = mLayouts.insert(std::move(aPreparedLayout));
-		assert(result.second);
-		return *result.first;
+		return s.mLayouts.emplace(hash, std::move(aPreparedLayout))->second;
 	}
 
 	std::optional<descriptor_set> descriptor_cache::get_descriptor_set_from_cache(const descriptor_set& aPreparedSet)
 	{
-		const auto it = mSets.find(aPreparedSet);
-		if (mSets.end() != it) {
-			auto found = *it;
-			// This might not be the veeeery best place to alter the set-id, but let's go for it:
-			found.set_set_id(aPreparedSet.set_id());
-			return found;
+		const auto hash = aPreparedSet.content_hash();
+		auto& s = shard_for(hash);
+		std::shared_lock lock(s.mMutex);
+		const auto [first, last] = s.mSets.equal_range(hash);
+		for (auto it = first; it != last; ++it) {
+			if (it->second.mSet == aPreparedSet) {
+				touch(it->second);
+				auto found = it->second.mSet;
+				// This might not be the veeeery best place to alter the set-id, but let's go for it:
+				found.set_set_id(aPreparedSet.set_id());
+				return found;
+			}
 		}
 		return {};
 	}
 
+	bool descriptor_cache::find_cached_set(const binding_data* const* aBegin, const binding_data* const* aEnd, uint64_t aContentHash, descriptor_set& aOutSet)
+	{
+		const auto n = static_cast<size_t>(aEnd - aBegin);
+		auto& s = shard_for(aContentHash);
+		std::shared_lock lock(s.mMutex);
+		const auto [first, last] = s.mSets.equal_range(aContentHash);
+		for (auto it = first; it != last; ++it) {
+			const auto& candidate = it->second.mSet;
+			if (candidate.number_of_writes() != n) {
+				continue;
+			}
+			bool same = true;
+			for (size_t i = 0; same && i < n; ++i) {
+				same = aBegin[i]->matches(candidate.write_at(i));
+			}
+			if (same) {
+				touch(it->second);
+				aOutSet = candidate;
+				return true;
+			}
+		}
+		return false;
+	}
+
 	std::vector<descriptor_set> descriptor_cache::alloc_new_descriptor_sets(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts, std::vector<descriptor_set> aPreparedSets)
 	{
 		assert(aLayouts.size() == aPreparedSets.size());
 
-		std::vector<descriptor_set> result;
 		if (aLayouts.empty()) {
-			return result;
+			return {};
 		}
 
 		const int n = static_cast<int>(aLayouts.size());
@@ -3582,39 +5200,26 @@ namespace avk
 		// or alloc a new pool:
 		auto allocRequest = descriptor_alloc_request{ layoutsOfUniqueSets };
 
-		std::shared_ptr<descriptor_pool> pool = nullptr;
+		observe_demand(allocRequest);
 		std::vector<vk::DescriptorSet> setHandles;
-
-		auto poolToTry = get_descriptor_pool_for_layouts(allocRequest);
-
-		int maxTries = 3;
-		while (!pool && maxTries-- > 0) {
-			try {
-				assert(poolToTry->has_capacity_for(allocRequest));
-				// Alloc the whole thing:
-				setHandles = poolToTry->allocate(aLayouts);
-				assert(setHandles.size() == aPreparedSets.size());
-				// Success
-				pool = poolToTry;
-			}
-			catch (vk::OutOfPoolMemoryError& fail) {
-				AVK_LOG_ERROR(std::string("Failed to allocate descriptor sets from pool: ") + fail.what());
-				switch (maxTries) {
-				case 1:
-					AVK_LOG_INFO("Trying again with doubled size requirements...");
-					allocRequest = allocRequest.multiply_size_requirements(2u);
-					poolToTry = get_descriptor_pool_for_layouts(allocRequest);
-				default:
-					AVK_LOG_INFO("Trying again with new pool..."); // and possibly doubled size requirements, depending on whether maxTries is 2 or 0
-					poolToTry = get_descriptor_pool_for_layouts(allocRequest, true);
-				}
-			}
-		}
-
-		assert(pool);
-		assert(setHandles.size() > 0);
+		auto pool = get_descriptor_pool_for_layouts(allocRequest);
+		assert(pool->has_capacity_for(allocRequest));
+		auto allocResult = pool->try_allocate(layoutsOfUniqueSets, setHandles);
+		if (vk::Result::eErrorOutOfPoolMemory == allocResult || vk::Result::eErrorFragmentedPool == allocResult) {
+			// The pool's bookkeeping does not account for fragmentation => retire it, and use a fresh one:
+			AVK_LOG_INFO("Descriptor pool exhausted (" + vk::to_string(allocResult) + "). Trying again with a new pool...");
+			pool->set_remaining_sets(0);
+			pool = get_descriptor_pool_for_layouts(allocRequest, true);
+			allocResult = pool->try_allocate(layoutsOfUniqueSets, setHandles);
+		}
+		if (vk::Result::eSuccess != allocResult) {
+			throw avk::runtime_error("Failed to allocate descriptor sets for descriptor_cache '" + mName + "': " + vk::to_string(allocResult));
+		}
+		assert(setHandles.size() == layoutsOfUniqueSets.size());
+		std::vector<descriptor_set> result;
 
 		// Finish configuration (most importantly: write descriptors), and just make copies for the duplicates:
+		size_t nextHandle = 0; // Handles have only been allocated for the unique sets
 		for (int i = 0; i < n; ++i) {
 			const bool isDuplicate = -1 != duplicateSetIndices[i];
 			const int setIndex = isDuplicate ? duplicateSetIndices[i] : i;
@@ -3622,15 +5227,30 @@ namespace avk
 			if (!isDuplicate) {
 				assert(setIndex == i);
 				auto& setToBeCompleted = aPreparedSets[setIndex];
-				setToBeCompleted.link_to_handle_and_pool(std::move(setHandles[setIndex]), pool);
-				setToBeCompleted.update_data_pointers();
-				setToBeCompleted.write_descriptors();
+				setToBeCompleted.link_to_handle_and_pool(setHandles[nextHandle++], pool);
+				setToBeCompleted.write_descriptors(aLayouts[setIndex]);
 
 				// Your soul... is mine:
-				const auto cachedSet = mSets.insert(std::move(setToBeCompleted));
-				assert(cachedSet.second); // This must not happen. Duplicate handling should have caught such cases.
+				const auto setId = setToBeCompleted.set_id();
+				const auto hash = setToBeCompleted.content_hash();
+				auto& s = shard_for(hash);
+				std::unique_lock lock(s.mMutex);
+				// If another thread has cached an identical set in the meantime, that one is used. (Ours stays allocated in the pool.)
+				auto [first, last] = s.mSets.equal_range(hash);
+				while (first != last && first->second.mSet != setToBeCompleted) {
+					++first;
+				}
+				auto cachedSet = first;
+				if (first == last) {
+					cachedSet = s.mSets.emplace(std::piecewise_construct, std::forward_as_tuple(hash), std::forward_as_tuple(std::move(setToBeCompleted), current_frame()));
+					index_set(s, cachedSet->second.mSet);
+				}
+				else {
+					touch(cachedSet->second);
+				}
 				// Done. Store for result:
-				result.push_back(*cachedSet.first); // Make a copy!
+				result.push_back(cachedSet->second.mSet); // Make a copy!
+				result.back().set_set_id(setId);
 			}
 			else {
 				assert(setIndex < i);
@@ -3643,24 +5263,134 @@ namespace avk
 
 	void descriptor_cache::cleanup()
 	{
-		mSets.clear();
-		mLayouts.clear();
+		for (auto& s : mState->mShards) {
+			std::unique_lock lock(s.mMutex);
+			s.mSetsByHandle.clear();
+			s.mSets.clear();
+			s.mLayouts.clear();
+		}
+	}
+
+	size_t descriptor_cache::next_frame()
+	{
+		const auto currentFrame = ++mState->mCurrentFrame;
+		// Sets which have been used by any of the frames which might still be in flight must stay:
+		if (0 == mMaxNumberOfSets || currentFrame < mFramesInFlight) {
+			return 0;
+		}
+		const auto lastEvictableFrame = currentFrame - mFramesInFlight;
+
+		// Only count the sets as long as the cache stays below its limit, which is the common case:
+		size_t numSets = 0;
+		for (auto& s : mState->mShards) {
+			std::shared_lock lock(s.mMutex);
+			numSets += s.mSets.size();
+		}
+		if (numSets <= mMaxNumberOfSets) {
+			return 0;
+		}
+
+		// There is an excess => gather the frames of all sets which are not used by any frame in flight:
+		std::vector<uint64_t> evictableFrames;
+		evictableFrames.reserve(numSets);
+		numSets = 0;
+		for (auto& s : mState->mShards) {
+			std::shared_lock lock(s.mMutex);
+			numSets += s.mSets.size();
+			for (const auto& [hash, entry] : s.mSets) {
+				const auto frame = entry.mLastUsedFrame.load(std::memory_order_relaxed);
+				if (frame <= lastEvictableFrame) {
+					evictableFrames.push_back(frame);
+				}
+			}
+		}
+		if (numSets <= mMaxNumberOfSets) {
+			return 0; // Other threads have removed sets in the meantime
+		}
+
+		// Evict down to a bit below the limit, s.t. eviction does not happen every frame:
+		const auto target = mMaxNumberOfSets - mMaxNumberOfSets / 8;
+		const auto numToEvict = std::min(numSets - target, evictableFrames.size());
+		if (0 == numToEvict) {
+			AVK_LOG_WARNING("The descriptor cache '" + mName + "' exceeds its limit of " + std::to_string(mMaxNumberOfSets) + " sets, but all of them are in use by frames in flight.");
+			return 0;
+		}
+
+		// Least recently used first => find the frame up to which sets are evicted:
+		std::nth_element(std::begin(evictableFrames), std::begin(evictableFrames) + (numToEvict - 1), std::end(evictableFrames));
+		const auto cutoffFrame = evictableFrames[numToEvict - 1];
+		auto numToEvictAtCutoff = static_cast<size_t>(std::count(std::begin(evictableFrames), std::begin(evictableFrames) + numToEvict, cutoffFrame));
+
+		size_t numEvicted = 0;
+		for (auto& s : mState->mShards) {
+			std::unique_lock lock(s.mMutex);
+			for (auto it = s.mSets.begin(); it != s.mSets.end();) {
+				// Sets which have been used in the meantime have a newer frame than the cutoff frame:
+				const auto frame = it->second.mLastUsedFrame.load(std::memory_order_relaxed);
+				const bool evict = frame < cutoffFrame || (frame == cutoffFrame && numToEvictAtCutoff > 0);
+				auto next = std::next(it);
+				if (evict) {
+					if (frame == cutoffFrame) {
+						--numToEvictAtCutoff;
+					}
+					erase_set(s, &it->second.mSet);
+					++numEvicted;
+				}
+				it = next;
+			}
+		}
+		return numEvicted;
+	}
+
+	std::shared_ptr<descriptor_pool> descriptor_cache::make_recyclable(descriptor_pool aPool)
+	{
+		return std::shared_ptr<descriptor_pool>(new descriptor_pool(std::move(aPool)), [recycler = std::weak_ptr<pool_recycler>(mState->mRecycler)](descriptor_pool* aPoolToRecycle) {
+			std::unique_ptr<descriptor_pool> pool(aPoolToRecycle);
+			auto r = recycler.lock();
+			if (!r) {
+				return; // The cache is gone => destroy the pool
+			}
+			// No set refers to this pool anymore => all of its sets can be freed:
+			pool->reset();
+			std::scoped_lock lock(r->mMutex);
+			if (r->mPools.size() < pool_recycler::sMaxNumberOfPools) {
+				r->mPools.push_back(std::move(pool));
+			}
+		});
+	}
+
+	std::shared_ptr<descriptor_pool> descriptor_cache::take_recycled_pool(const descriptor_alloc_request& aAllocRequest)
+	{
+		std::unique_ptr<descriptor_pool> pool;
+		{
+			std::scoped_lock lock(mState->mRecycler->mMutex);
+			auto& recycled = mState->mRecycler->mPools;
+			const auto it = std::find_if(std::begin(recycled), std::end(recycled), [&aAllocRequest](const std::unique_ptr<descriptor_pool>& aPool) {
+				return aPool->has_capacity_for(aAllocRequest);
+			});
+			if (std::end(recycled) == it) {
+				return {};
+			}
+			pool = std::move(*it);
+			recycled.erase(it);
+		}
+		return make_recyclable(std::move(*pool));
 	}
 
 	std::shared_ptr<descriptor_pool> descriptor_cache::get_descriptor_pool_for_layouts(const descriptor_alloc_request& aAllocRequest, bool aRequestNewPool)
 	{
 		// We'll allocate the pools per (thread and name)
 		auto tId = std::this_thread::get_id();
-		auto& pools = mDescriptorPools[tId];
+		auto& pools = pools_of_this_thread();
 
 		// First of all, do some cleanup => remove all pools which no longer exist:
-		pools.erase(std::remove_if(std::begin(pools), std::end(pools), [](const std::weak_ptr<descriptor_pool>& ptr) {
+		pools.mPools.erase(std::remove_if(std::begin(pools.mPools), std::end(pools.mPools), [](const std::weak_ptr<descriptor_pool>& ptr) {
 			return ptr.expired();
-		}), std::end(pools));
+		}), std::end(pools.mPools));
 
 		// Find a pool which is capable of allocating this:
 		if (!aRequestNewPool) {
-			for (auto& pool : pools) {
+			for (auto& pool : pools.mPools) {
 				if (auto sptr = pool.lock()) {
 					if (sptr->has_capacity_for(aAllocRequest)) {
 						return sptr;
@@ -3669,35 +5399,64 @@ namespace avk
 			}
 		}
 
+		// Before creating a new pool, try to reuse one which has been emptied:
+		if (auto recycled = take_recycled_pool(aAllocRequest)) {
+			pools.mPools.emplace_back(recycled);
+			return recycled;
+		}
+
 		// We weren't lucky (or new pool has been requested) => create a new pool:
 		AVK_LOG_INFO("Allocating new descriptor pool for thread[" + [tId]() { std::stringstream ss; ss << tId; return ss.str(); }() + "] and name['" + mName + "]");
 
-		// TODO: On AMD, it seems that all the entries have to be multiplied as well, while on NVIDIA, only multiplying the number of sets seems to be sufficient
-		//       => How to handle this? Overallocation is as bad as underallocation. Shall we make use of exceptions? Shall we 'if' on the vendor?
+		// Grow the number of sets geometrically, starting from prealloc_factor() times the request:
+		const auto minSets = std::min(aAllocRequest.num_sets() * static_cast<uint32_t>(std::max(prealloc_factor(), 1)), sMaxSetsPerPool);
+		const auto numSets = std::max(std::clamp(pools.mLastPoolSets * 2u, minSets, sMaxSetsPerPool), aAllocRequest.num_sets());
+		pools.mLastPoolSets = numSets;
 
-		const bool isNvidia = 0x12d2 == mRoot->physical_device().getProperties().vendorID;
-		auto amplifiedAllocRequest = aAllocRequest.multiply_size_requirements(prealloc_factor());
-		//if (!isNvidia) { // Let's 'if' on the vendor and see what happens...
-		//}
+		// Distribute the descriptors according to the mix of types observed so far, but fit at least this request:
+		std::vector<vk::DescriptorPoolSize> poolSizes;
+		const auto observedSets = std::max(pools.mObservedSets, uint64_t{ 1 });
+		for (const auto& observed : pools.mObservedSizes) {
+			const auto perPool = (static_cast<uint64_t>(observed.descriptorCount) * numSets + observedSets - 1) / observedSets;
+			poolSizes.emplace_back(observed.type, static_cast<uint32_t>(std::min<uint64_t>(perPool, std::numeric_limits<uint32_t>::max())));
+		}
+		for (const auto& required : aAllocRequest.accumulated_pool_sizes()) {
+			auto it = std::find_if(std::begin(poolSizes), std::end(poolSizes), [&required](const vk::DescriptorPoolSize& aSize) { return aSize.type == required.type; });
+			if (std::end(poolSizes) == it) {
+				poolSizes.push_back(required);
+			}
+			else {
+				it->descriptorCount = std::max(it->descriptorCount, required.descriptorCount);
+			}
+		}
 
-		auto newPool = root::create_descriptor_pool(mRoot->device(), mRoot->dispatch_loader_core(),
-			isNvidia
-			  ? aAllocRequest.accumulated_pool_sizes()
-			  : amplifiedAllocRequest.accumulated_pool_sizes(),
-			isNvidia
-			  ? aAllocRequest.num_sets() * prealloc_factor()
-			  : aAllocRequest.num_sets() * prealloc_factor() * 2 // the last factor is a "magic number"/"educated guess"/"preemtive strike"
-		);
+		auto newPoolPtr = make_recyclable(root::create_descriptor_pool(mRoot->device(), mRoot->dispatch_loader_core(), poolSizes, static_cast<int>(numSets)));
+		pools.mPools.emplace_back(newPoolPtr); // Store as a weak_ptr
+		return newPoolPtr;
+	}
 
-		auto newPoolPtr = std::make_shared<descriptor_pool>(std::move(newPool));
-
-		//  However, set the stored capacities to the amplified version, to not mess up our internal "has_capacity_for-logic":
-		newPoolPtr->set_remaining_capacities(amplifiedAllocRequest.accumulated_pool_sizes());
-		//if (!isNvidia) {
-		//}
+	void descriptor_cache::observe_demand(const descriptor_alloc_request& aAllocRequest)
+	{
+		auto& pools = pools_of_this_thread();
+		for (const auto& size : aAllocRequest.accumulated_pool_sizes()) {
+			auto it = std::find_if(std::begin(pools.mObservedSizes), std::end(pools.mObservedSizes), [&size](const vk::DescriptorPoolSize& aSize) { return aSize.type == size.type; });
+			if (std::end(pools.mObservedSizes) == it) {
+				pools.mObservedSizes.push_back(size);
+			}
+			else {
+				it->descriptorCount += size.descriptorCount;
+			}
+		}
+		pools.mObservedSets += aAllocRequest.num_sets();
 
-		pools.emplace_back(newPoolPtr); // Store as a weak_ptr
-		return newPoolPtr;
+		// Keep following the recent mix: halve the history before the counts could overflow
+		const bool countsGetLarge = std::any_of(std::begin(pools.mObservedSizes), std::end(pools.mObservedSizes), [](const vk::DescriptorPoolSize& aSize) { return aSize.descriptorCount > (1u << 30); });
+		if (countsGetLarge || pools.mObservedSets > (1u << 24)) {
+			for (auto& size : pools.mObservedSizes) {
+				size.descriptorCount = (size.descriptorCount + 1u) / 2u;
+			}
+			pools.mObservedSets = (pools.mObservedSets + 1u) / 2u;
+		}
 	}
 #pragma endregion
 
@@ -3705,43 +5464,48 @@ namespace avk
 
 	bool operator ==(const descriptor_set& left, const descriptor_set& right)
 	{
-		const auto n = left.mOrderedDescriptorDataWrites.size();
-		if (n != right.mOrderedDescriptorDataWrites.size()) {
+		const auto n = left.number_of_writes();
+		if (n != right.number_of_writes()) {
 			return false;
 		}
+		if (left.mData == right.mData) {
+			return true;
+		}
 		for (size_t i = 0; i < n; ++i) {
-			if (left.mOrderedDescriptorDataWrites[i].dstBinding			!= right.mOrderedDescriptorDataWrites[i].dstBinding			)			{ return false; }
-			if (left.mOrderedDescriptorDataWrites[i].dstArrayElement	!= right.mOrderedDescriptorDataWrites[i].dstArrayElement	)			{ return false; }
-			if (left.mOrderedDescriptorDataWrites[i].descriptorCount	!= right.mOrderedDescriptorDataWrites[i].descriptorCount	)			{ return false; }
-			if (left.mOrderedDescriptorDataWrites[i].descriptorType		!= right.mOrderedDescriptorDataWrites[i].descriptorType		)			{ return false; }
-			if (nullptr != left.mOrderedDescriptorDataWrites[i].pImageInfo) {
-				if (nullptr == right.mOrderedDescriptorDataWrites[i].pImageInfo)																{ return false; }
-				for (size_t j = 0; j < left.mOrderedDescriptorDataWrites[i].descriptorCount; ++j) {
-					if (left.mOrderedDescriptorDataWrites[i].pImageInfo[j] != right.mOrderedDescriptorDataWrites[i].pImageInfo[j])				{ return false; }
+			const auto& l = left.write_at(i);
+			const auto& r = right.write_at(i);
+			if (l.dstBinding		!= r.dstBinding		)										{ return false; }
+			if (l.dstArrayElement	!= r.dstArrayElement)										{ return false; }
+			if (l.descriptorCount	!= r.descriptorCount)										{ return false; }
+			if (l.descriptorType	!= r.descriptorType	)										{ return false; }
+			if (nullptr != l.pImageInfo) {
+				if (nullptr == r.pImageInfo)													{ return false; }
+				for (size_t j = 0; j < l.descriptorCount; ++j) {
+					if (l.pImageInfo[j] != r.pImageInfo[j])										{ return false; }
 				}
 			}
-			if (nullptr != left.mOrderedDescriptorDataWrites[i].pBufferInfo) {
-				if (nullptr == right.mOrderedDescriptorDataWrites[i].pBufferInfo)																{ return false; }
-				for (size_t j = 0; j < left.mOrderedDescriptorDataWrites[i].descriptorCount; ++j) {
-					if (left.mOrderedDescriptorDataWrites[i].pBufferInfo[j] != right.mOrderedDescriptorDataWrites[i].pBufferInfo[j])			{ return false; }
+			if (nullptr != l.pBufferInfo) {
+				if (nullptr == r.pBufferInfo)													{ return false; }
+				for (size_t j = 0; j < l.descriptorCount; ++j) {
+					if (l.pBufferInfo[j] != r.pBufferInfo[j])									{ return false; }
 				}
 			}
-			if (nullptr != left.mOrderedDescriptorDataWrites[i].pTexelBufferView) {
-				if (nullptr == right.mOrderedDescriptorDataWrites[i].pTexelBufferView)															{ return false; }
-				for (size_t j = 0; j < left.mOrderedDescriptorDataWrites[i].descriptorCount; ++j) {
-					if (left.mOrderedDescriptorDataWrites[i].pTexelBufferView[j] != right.mOrderedDescriptorDataWrites[i].pTexelBufferView[j])	{ return false; }
+			if (nullptr != l.pTexelBufferView) {
+				if (nullptr == r.pTexelBufferView)												{ return false; }
+				for (size_t j = 0; j < l.descriptorCount; ++j) {
+					if (l.pTexelBufferView[j] != r.pTexelBufferView[j])							{ return false; }
 				}
 			}
 
 #if VK_HEADER_VERSION >= 135
-			if (nullptr != left.mOrderedDescriptorDataWrites[i].pNext) {
-				if (nullptr == right.mOrderedDescriptorDataWrites[i].pNext)																		{ return false; }
-				if (left.mOrderedDescriptorDataWrites[i].descriptorType == vk::DescriptorType::eAccelerationStructureKHR) {
-					const auto* asInfoLeft = reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(left.mOrderedDescriptorDataWrites[i].pNext);
-					const auto* asInfoRight = reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(right.mOrderedDescriptorDataWrites[i].pNext);
-					if (asInfoLeft->accelerationStructureCount != asInfoRight->accelerationStructureCount)										{ return false; }
+			if (nullptr != l.pNext) {
+				if (nullptr == r.pNext)															{ return false; }
+				if (l.descriptorType == vk::DescriptorType::eAccelerationStructureKHR) {
+					const auto* asInfoLeft = reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(l.pNext);
+					const auto* asInfoRight = reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(r.pNext);
+					if (asInfoLeft->accelerationStructureCount != asInfoRight->accelerationStructureCount)	{ return false; }
 					for (size_t j = 0; j < asInfoLeft->accelerationStructureCount; ++j) {
-						if (asInfoLeft->pAccelerationStructures[j] != asInfoRight->pAccelerationStructures[j])									{ return false; }
+						if (asInfoLeft->pAccelerationStructures[j] != asInfoRight->pAccelerationStructures[j])	{ return false; }
 					}
 				}
 			}
@@ -3755,50 +5519,114 @@ namespace avk
 		return !(left == right);
 	}
 
+	descriptor_set::data& descriptor_set::mutable_data()
+	{
+		if (!mData) {
+			mData = std::make_shared<data>();
+		}
+		else if (mData.use_count() > 1) {
+			// Shared with other instances => copy, and let the copied writes point to the copied data:
+			mData = std::make_shared<data>(*mData);
+			update_data_pointers(*mData);
+		}
+		return *mData;
+	}
+
 	void descriptor_set::update_data_pointers()
 	{
-		for (auto& w : mOrderedDescriptorDataWrites) {
-			assert(w.dstSet == mOrderedDescriptorDataWrites[0].dstSet);
-			{
-				auto it = std::find_if(std::begin(mStoredImageInfos), std::end(mStoredImageInfos), [binding = w.dstBinding](const auto& element) { return std::get<uint32_t>(element) == binding; });
-				if (it != std::end(mStoredImageInfos)) {
-					w.pImageInfo = std::get<std::vector<vk::DescriptorImageInfo>>(*it).data();
-				}
-				else {
-					w.pImageInfo = nullptr;
-				}
-			}
-			{
-				auto it = std::find_if(std::begin(mStoredBufferInfos), std::end(mStoredBufferInfos), [binding = w.dstBinding](const auto& element) { return std::get<uint32_t>(element) == binding; });
-				if (it != std::end(mStoredBufferInfos)) {
-					w.pBufferInfo = std::get<std::vector<vk::DescriptorBufferInfo>>(*it).data();
-				}
-				else {
-					w.pBufferInfo = nullptr;
-				}
+		// The pointers of shared data are already consistent, because shared data is never modified:
+		if (mData && 1 == mData.use_count()) {
+			update_data_pointers(*mData);
+		}
+	}
+
+	std::optional<descriptor_set::payload_kind> descriptor_set::payload_kind_of(vk::DescriptorType aType)
+	{
+		switch (aType) {
+		case vk::DescriptorType::eSampler:
+		case vk::DescriptorType::eCombinedImageSampler:
+		case vk::DescriptorType::eSampledImage:
+		case vk::DescriptorType::eStorageImage:
+		case vk::DescriptorType::eInputAttachment:
+			return payload_kind::image_infos;
+		case vk::DescriptorType::eUniformTexelBuffer:
+		case vk::DescriptorType::eStorageTexelBuffer:
+			return payload_kind::buffer_views;
+		case vk::DescriptorType::eUniformBuffer:
+		case vk::DescriptorType::eStorageBuffer:
+		case vk::DescriptorType::eUniformBufferDynamic:
+		case vk::DescriptorType::eStorageBufferDynamic:
+			return payload_kind::buffer_infos;
+#if VK_HEADER_VERSION >= 135
+		case vk::DescriptorType::eAccelerationStructureKHR:
+			return payload_kind::acceleration_structures;
+#endif
+		default:
+			return {};
+		}
+	}
+
+	size_t descriptor_set::payload_stride(vk::DescriptorType aType)
+	{
+		const auto kind = payload_kind_of(aType);
+		if (!kind.has_value()) {
+			return 0;
+		}
+		switch (*kind) {
+		case payload_kind::image_infos:
+			return sizeof(vk::DescriptorImageInfo);
+		case payload_kind::buffer_infos:
+			return sizeof(vk::DescriptorBufferInfo);
+		case payload_kind::buffer_views:
+			return sizeof(vk::BufferView);
+#if VK_HEADER_VERSION >= 135
+		case payload_kind::acceleration_structures:
+			return sizeof(vk::AccelerationStructureKHR);
+#endif
+		default:
+			return 0;
+		}
+	}
+
+	void descriptor_set::update_data_pointers(data& aData)
+	{
+		const auto* payload = reinterpret_cast<const uint8_t*>(aData.mPayload.data());
+		for (auto& w : aData.mOrderedDescriptorDataWrites) {
+			assert(w.dstSet == aData.mOrderedDescriptorDataWrites[0].dstSet);
+			w.pImageInfo = nullptr;
+			w.pBufferInfo = nullptr;
+			w.pTexelBufferView = nullptr;
+#if VK_HEADER_VERSION >= 135
+			w.pNext = nullptr;
+#endif
+
+			const auto it = std::find_if(std::begin(aData.mPayloadEntries), std::end(aData.mPayloadEntries), [binding = w.dstBinding](const payload_entry& element) { return element.mBinding == binding; });
+			if (std::end(aData.mPayloadEntries) == it) {
+				continue;
 			}
+			const auto* descriptors = payload + it->mOffset;
+			switch (it->mKind) {
+			case payload_kind::image_infos:
+				w.pImageInfo = reinterpret_cast<const vk::DescriptorImageInfo*>(descriptors);
+				break;
+			case payload_kind::buffer_infos:
+				w.pBufferInfo = reinterpret_cast<const vk::DescriptorBufferInfo*>(descriptors);
+				break;
+			case payload_kind::buffer_views:
+				w.pTexelBufferView = reinterpret_cast<const vk::BufferView*>(descriptors);
+				break;
+			case payload_kind::acceleration_structures:
 #if VK_HEADER_VERSION >= 135
-			{
-				auto it = std::find_if(std::begin(mStoredAccelerationStructureWrites), std::end(mStoredAccelerationStructureWrites), [binding = w.dstBinding](const auto& element) { return std::get<uint32_t>(element) == binding; });
-				if (it != std::end(mStoredAccelerationStructureWrites)) {
-					auto& tpl = std::get<1>(*it);
-					w.pNext = &std::get<vk::WriteDescriptorSetAccelerationStructureKHR>(tpl);
-					// Also update the pointer WITHIN the vk::WriteDescriptorSetAccelerationStructureKHR... OMG!
-					std::get<vk::WriteDescriptorSetAccelerationStructureKHR>(tpl).pAccelerationStructures = std::get<1>(tpl).data();
-				}
-				else {
-					w.pNext = nullptr;
+				{
+					auto asIt = std::find_if(std::begin(aData.mAccelerationStructureWrites), std::end(aData.mAccelerationStructureWrites), [binding = w.dstBinding](const auto& element) { return std::get<uint32_t>(element) == binding; });
+					if (std::end(aData.mAccelerationStructureWrites) != asIt) {
+						auto& asWrite = std::get<vk::WriteDescriptorSetAccelerationStructureKHR>(*asIt);
+						asWrite.pAccelerationStructures = reinterpret_cast<const vk::AccelerationStructureKHR*>(descriptors);
+						w.pNext = &asWrite;
+					}
 				}
-			}
 #endif
-			{
-				auto it = std::find_if(std::begin(mStoredBufferViews), std::end(mStoredBufferViews), [binding = w.dstBinding](const auto& element) { return std::get<uint32_t>(element) == binding; });
-				if (it != std::end(mStoredBufferViews)) {
-					w.pTexelBufferView = std::get<std::vector<vk::BufferView>>(*it).data();
-				}
-				else {
-					w.pTexelBufferView = nullptr;
-				}
+				break;
 			}
 		}
 	}
@@ -3806,7 +5634,7 @@ namespace avk
 	void descriptor_set::link_to_handle_and_pool(vk::DescriptorSet aHandle, std::shared_ptr<descriptor_pool> aPool)
 	{
 		mDescriptorSet = aHandle;
-		for (auto& w : mOrderedDescriptorDataWrites) {
+		for (auto& w : mutable_data().mOrderedDescriptorDataWrites) {
 			w.setDstSet(handle());
 		}
 		mPool = std::move(aPool);
@@ -3815,309 +5643,791 @@ namespace avk
 	void descriptor_set::write_descriptors()
 	{
 		assert(mDescriptorSet);
-		update_data_pointers();
-		mPool.get()->mDescriptorPool.getOwner().updateDescriptorSets(static_cast<uint32_t>(mOrderedDescriptorDataWrites.size()), mOrderedDescriptorDataWrites.data(), 0u, nullptr);
+		// The writes' pointers are fixed up whenever the data changes => they are valid here:
+		mPool.get()->mDescriptorPool.getOwner().updateDescriptorSets(static_cast<uint32_t>(number_of_writes()), number_of_writes() > 0 ? &write_at(0) : nullptr, 0u, nullptr);
+	}
+
+	void descriptor_set::write_descriptors(const descriptor_set_layout& aLayout)
+	{
+		if (!matches_update_template_of(aLayout)) {
+			write_descriptors();
+			return;
+		}
+		assert(mDescriptorSet);
+		mPool.get()->mDescriptorPool.getOwner().updateDescriptorSetWithTemplate(mDescriptorSet, aLayout.update_template_handle(), payload());
+	}
+
+	bool descriptor_set::matches_update_template_of(const descriptor_set_layout& aLayout) const
+	{
+		if (!aLayout.has_update_template() || !mData) {
+			return false;
+		}
+		const auto n = aLayout.number_of_bindings();
+		if (n != mData->mPayloadEntries.size() || n != number_of_writes()) {
+			return false;
+		}
+		uint32_t offset = 0;
+		for (size_t i = 0; i < n; ++i) {
+			const auto& binding = aLayout.binding_at(i);
+			const auto& entry = mData->mPayloadEntries[i];
+			const auto& w = write_at(i);
+			if (entry.mBinding != binding.binding || w.dstBinding != binding.binding || w.descriptorType != binding.descriptorType
+				|| entry.mCount != binding.descriptorCount || entry.mOffset != offset || payload_kind_of(binding.descriptorType) != entry.mKind) {
+				return false;
+			}
+			offset += static_cast<uint32_t>(payload_size(binding.descriptorType, binding.descriptorCount));
+		}
+		return true;
 	}
 
 	std::vector<descriptor_set> descriptor_cache::get_or_create_descriptor_sets(std::initializer_list<binding_data> aBindings)
 	{
-		std::vector<binding_data> orderedBindings;
-		uint32_t minSetId = std::numeric_limits<uint32_t>::max();
-		uint32_t maxSetId = std::numeric_limits<uint32_t>::min();
+		std::vector<descriptor_set> result;
+		get_or_create_descriptor_sets(aBindings, result);
+		return result;
+	}
 
-		// Step 1: order the bindings
-		for (auto& b : aBindings) {
-			minSetId = std::min(minSetId, b.mSetId);
-			maxSetId = std::max(maxSetId, b.mSetId);
-			auto it = std::lower_bound(std::begin(orderedBindings), std::end(orderedBindings), b); // use operator<
-			orderedBindings.insert(it, b);
+	void descriptor_cache::get_or_create_descriptor_sets(std::initializer_list<binding_data> aBindings, std::vector<descriptor_set>& aResult)
+	{
+		// Step 1: order the bindings by set-id and binding-id. Typically, there are only few => sort pointers to them on the stack:
+		constexpr size_t maxBindingsOnStack = 32;
+		std::array<const binding_data*, maxBindingsOnStack> stackStorage;
+		std::vector<const binding_data*> heapStorage;
+		const auto n = aBindings.size();
+		const binding_data** orderedBindings = stackStorage.data();
+		if (n > maxBindingsOnStack) {
+			heapStorage.resize(n);
+			orderedBindings = heapStorage.data();
+		}
+		{
+			size_t i = 0;
+			for (auto& b : aBindings) {
+				orderedBindings[i++] = &b;
+			}
 		}
+		std::sort(orderedBindings, orderedBindings + n, [](const binding_data* first, const binding_data* second) {
+			return *first < *second; // use operator<
+		});
 
-		std::vector<std::reference_wrapper<const descriptor_set_layout>> layouts;
-		std::vector<descriptor_set> preparedSets;
-		std::vector<descriptor_set> cachedSets;
-		std::vector<bool>           validSets;
+		get_or_create_descriptor_sets(orderedBindings, n, aResult);
+	}
 
-		// Step 2: go through all the sets, get or alloc layouts, and see if the descriptor sets are already in cache, by chance.
-		for (uint32_t setId = minSetId; setId <= maxSetId; ++setId) {
-			auto lb = std::lower_bound(std::begin(orderedBindings), std::end(orderedBindings), binding_data{ setId },
-				[](const binding_data& first, const binding_data& second) -> bool {
-					return first.mSetId < second.mSetId;
-				});
-			auto ub = std::upper_bound(std::begin(orderedBindings), std::end(orderedBindings), binding_data{ setId },
-				[](const binding_data& first, const binding_data& second) -> bool {
-					return first.mSetId < second.mSetId;
-				});
+	void descriptor_cache::get_or_create_descriptor_sets(const binding_data* const* aOrderedBindings, size_t aNumBindings, std::vector<descriptor_set>& aResult)
+	{
+		aResult.clear();
+		const auto* orderedBindings = aOrderedBindings;
+		const auto n = aNumBindings;
 
-			// Handle empty sets:
-			if (lb == ub) {
-				continue;
+		// Step 2: go through all the sets and see if they are already in cache. Only prepare those which are not:
+		std::vector<std::reference_wrapper<const descriptor_set_layout>> layoutsForAlloc;
+		std::vector<descriptor_set> toBeAlloced;
+		std::vector<size_t> indexMapping;
+		for (size_t begin = 0; begin < n;) {
+			size_t end = begin + 1;
+			while (end < n && orderedBindings[end]->mSetId == orderedBindings[begin]->mSetId) {
+				++end;
+			}
+
+			// Same hash as the one of a descriptor_set which is prepared from these bindings. Combined from
+			// the bindings' precomputed hashes, i.e., the descriptors are not hashed again on this path:
+			uint64_t contentHash = 0;
+			for (size_t i = begin; i < end; ++i) {
+				contentHash = descriptor_set::combine_content_hash(contentHash, *orderedBindings[i]);
 			}
 
-			const auto& layout = get_or_alloc_layout(descriptor_set_layout::prepare(lb, ub));
-			layouts.emplace_back(layout);
-			auto preparedSet = descriptor_set::prepare(lb, ub);
-			auto cachedSet = get_descriptor_set_from_cache(preparedSet);
-			if (cachedSet.has_value()) {
-				auto& back = cachedSets.emplace_back(std::move(cachedSet.value()));
-				validSets.push_back(true);
+			auto& resultSet = aResult.emplace_back();
+			if (find_cached_set(orderedBindings + begin, orderedBindings + end, contentHash, resultSet)) {
+				resultSet.set_set_id(orderedBindings[begin]->mSetId);
 			}
 			else {
-				cachedSets.emplace_back();
-				validSets.push_back(false);
+				std::vector<binding_data> bindingsOfSet;
+				for (size_t i = begin; i < end; ++i) {
+					bindingsOfSet.push_back(*orderedBindings[i]);
+				}
+				layoutsForAlloc.emplace_back(get_or_alloc_layout(descriptor_set_layout::prepare(std::begin(bindingsOfSet), std::end(bindingsOfSet))));
+				toBeAlloced.push_back(descriptor_set::prepare(std::begin(bindingsOfSet), std::end(bindingsOfSet)));
+				indexMapping.push_back(aResult.size() - 1);
 			}
-			preparedSets.emplace_back(std::move(preparedSet));
+			begin = end;
 		}
 
-		if (static_cast<int>(cachedSets.size()) == std::count(std::begin(validSets), std::end(validSets), true)) {
+		if (indexMapping.empty()) {
 			// Everything is cached; we're done.
-			return cachedSets;
+			return;
 		}
 
 		// HOWEVER, if not...
-		std::vector<std::reference_wrapper<const descriptor_set_layout>> layoutsForAlloc;
-		std::vector<descriptor_set> toBeAlloced;
-		std::vector<size_t> indexMapping;
-		for (size_t i = 0; i < cachedSets.size(); ++i) {
-			if (!validSets[i]) {
-				layoutsForAlloc.push_back(layouts[i]);
-				toBeAlloced.push_back(std::move(preparedSets[i]));
-				indexMapping.push_back(i);
-			}
-		}
 		auto nowAlsoInCache = alloc_new_descriptor_sets(layoutsForAlloc, std::move(toBeAlloced));
 		for (size_t i = 0; i < indexMapping.size(); ++i) {
-			cachedSets[indexMapping[i]] = nowAlsoInCache[i];
+			aResult[indexMapping[i]] = std::move(nowAlsoInCache[i]);
 		}
-		return cachedSets;
 	}
 
 	int descriptor_cache::remove_sets_with_handle(vk::ImageView aHandle)
 	{
-		int numDeleted = 0;
-		auto it = std::begin(mSets);
-		do {
-			it = std::find_if(std::begin(mSets), std::end(mSets), [aHandle](const descriptor_set& aSet) {
-				auto n = aSet.number_of_writes();
-				for (decltype(n) i = 0; i < n; ++i) {
-					const auto& w = aSet.write_at(i);
-					auto dn = w.descriptorCount;
-					if (0u == dn || nullptr == w.pImageInfo) {
-						continue;
-					}
-					for (decltype(dn) di = 0; di < dn; ++di) {
-						if (w.pImageInfo[di].imageView == aHandle) {
-							return true;
-						}
-					}
-				}
-				return false;
-			});
-
-			if (std::end(mSets) != it) {
-				mSets.erase(it);
-				++numDeleted;
-				// Iterator could (will) have been invalidated => reinitialize:
-				it = std::begin(mSets);
-			}
-		} while (std::end(mSets) != it);
-		return numDeleted;
+		return remove_sets_with_keys({ key_of(aHandle) });
 	}
 
 	int descriptor_cache::remove_sets_with_handle(vk::Buffer aHandle)
 	{
-		int numDeleted = 0;
-		auto it = std::begin(mSets);
-		do {
-			it = std::find_if(std::begin(mSets), std::end(mSets), [aHandle](const descriptor_set& aSet) {
-				auto n = aSet.number_of_writes();
-				for (decltype(n) i = 0; i < n; ++i) {
-					const auto& w = aSet.write_at(i);
-					auto dn = w.descriptorCount;
-					if (0u == dn || nullptr == w.pBufferInfo) {
-						continue;
-					}
-					for (decltype(dn) di = 0; di < dn; ++di) {
-						if (w.pBufferInfo[di].buffer == aHandle) {
-							return true;
-						}
-					}
-				}
-				return false;
-				});
-
-			if (std::end(mSets) != it) {
-				mSets.erase(it);
-				++numDeleted;
-				// Iterator could (will) have been invalidated => reinitialize:
-				it = std::begin(mSets);
-			}
-		} while (std::end(mSets) != it);
-		return numDeleted;
+		return remove_sets_with_keys({ key_of(aHandle) });
 	}
 
 	int descriptor_cache::remove_sets_with_handle(vk::Sampler aHandle)
 	{
-		int numDeleted = 0;
-		auto it = std::begin(mSets);
-		do {
-			it = std::find_if(std::begin(mSets), std::end(mSets), [aHandle](const descriptor_set& aSet) {
-				auto n = aSet.number_of_writes();
-				for (decltype(n) i = 0; i < n; ++i) {
-					const auto& w = aSet.write_at(i);
-					auto dn = w.descriptorCount;
-					if (0u == dn || nullptr == w.pImageInfo) {
-						continue;
-					}
-					for (decltype(dn) di = 0; di < dn; ++di) {
-						if (w.pImageInfo[di].sampler == aHandle) {
-							return true;
-						}
-					}
-				}
-				return false;
-				});
-
-			if (std::end(mSets) != it) {
-				mSets.erase(it);
-				++numDeleted;
-				// Iterator could (will) have been invalidated => reinitialize:
-				it = std::begin(mSets);
-			}
-		} while (std::end(mSets) != it);
-		return numDeleted;
+		return remove_sets_with_keys({ key_of(aHandle) });
 	}
 
 	int descriptor_cache::remove_sets_with_handle(vk::BufferView aHandle)
+	{
+		return remove_sets_with_keys({ key_of(aHandle) });
+	}
+
+	int descriptor_cache::remove_sets_with_keys(const std::vector<handle_key>& aKeys)
 	{
 		int numDeleted = 0;
-		auto it = std::begin(mSets);
-		do {
-			it = std::find_if(std::begin(mSets), std::end(mSets), [aHandle](const descriptor_set& aSet) {
-				auto n = aSet.number_of_writes();
-				for (decltype(n) i = 0; i < n; ++i) {
-					const auto& w = aSet.write_at(i);
-					auto dn = w.descriptorCount;
-					if (0u == dn || nullptr == w.pTexelBufferView) {
-						continue;
-					}
-					for (decltype(dn) di = 0; di < dn; ++di) {
-						if (w.pTexelBufferView[di] == aHandle) {
-							return true;
-						}
-					}
+		for (auto& s : mState->mShards) {
+			std::unique_lock lock(s.mMutex);
+			if (s.mSetsByHandle.empty()) {
+				continue;
+			}
+			for (const auto& key : aKeys) {
+				// Erasing a set also erases its index entries => continue with the first remaining one:
+				for (auto it = s.mSetsByHandle.find(key); s.mSetsByHandle.end() != it; it = s.mSetsByHandle.find(key)) {
+					erase_set(s, it->second);
+					++numDeleted;
 				}
-				return false;
-				});
-
-			if (std::end(mSets) != it) {
-				mSets.erase(it);
-				++numDeleted;
-				// Iterator could (will) have been invalidated => reinitialize:
-				it = std::begin(mSets);
 			}
-		} while (std::end(mSets) != it);
+		}
 		return numDeleted;
 	}
 
 #pragma endregion
 
-#pragma region fence definitions
-	fence_t::~fence_t()
+#pragma region descriptor ring definitions
+	void descriptor_ring::begin_frame(uint64_t aFrameId)
 	{
-		if (mCustomDeleter.has_value() && *mCustomDeleter) {
-			// If there is a custom deleter => call it now
-			(*mCustomDeleter)();
-			mCustomDeleter.reset();
+		mCurrentFrameIndex = static_cast<size_t>(aFrameId % mFrames.size());
+		auto& frame = mFrames[mCurrentFrameIndex];
+		// Only the pools up to the current one have been allocated from:
+		for (size_t i = 0; i <= frame.mCurrentPool && i < frame.mPools.size(); ++i) {
+			frame.mPools[i]->reset();
 		}
-		// Destroy the dependant instance before destroying myself
-		// ^ This is ensured by the order of the members
-		//   See: https://isocpp.org/wiki/faq/dtors#calling-member-dtors
+		frame.mCurrentPool = 0;
 	}
 
-	fence_t& fence_t::set_designated_queue(queue& _Queue)
+	std::vector<descriptor_set> descriptor_ring::allocate_descriptor_sets(std::initializer_list<binding_data> aBindings)
 	{
-		mQueue = &_Queue;
-		return *this;
+		std::vector<descriptor_set> result;
+		allocate_descriptor_sets(aBindings, result);
+		return result;
 	}
 
-	void fence_t::wait_until_signalled(std::optional<uint64_t> aTimeout) const
+	void descriptor_ring::allocate_descriptor_sets(std::initializer_list<binding_data> aBindings, std::vector<descriptor_set>& aResult)
 	{
-		// ReSharper disable once CppExpressionWithoutSideEffects
-		auto result = mFence.getOwner().waitForFences(1u, handle_ptr(), VK_TRUE, aTimeout.value_or(UINT64_MAX));
-		assert(static_cast<VkResult>(result) >= 0);
-	}
+		aResult.clear();
 
-	void fence_t::reset()
-	{
-		// ReSharper disable once CppExpressionWithoutSideEffects
-		mFence.getOwner().resetFences(1u, handle_ptr());
-		if (mCustomDeleter.has_value() && *mCustomDeleter) {
-			// If there is a custom deleter => call it now
-			(*mCustomDeleter)();
-			mCustomDeleter.reset();
+		// Order the bindings by set-id and binding-id:
+		constexpr size_t maxBindingsOnStack = 32;
+		std::array<const binding_data*, maxBindingsOnStack> stackStorage;
+		std::vector<const binding_data*> heapStorage;
+		const auto n = aBindings.size();
+		const binding_data** orderedBindings = stackStorage.data();
+		if (n > maxBindingsOnStack) {
+			heapStorage.resize(n);
+			orderedBindings = heapStorage.data();
+		}
+		{
+			size_t i = 0;
+			for (auto& b : aBindings) {
+				orderedBindings[i++] = &b;
+			}
+		}
+		std::sort(orderedBindings, orderedBindings + n, [](const binding_data* first, const binding_data* second) {
+			return *first < *second; // use operator<
+		});
+
+		// Prepare all the sets, and get their layouts:
+		std::vector<std::reference_wrapper<const descriptor_set_layout>> layouts;
+		std::vector<binding_data> bindingsOfSet;
+		for (size_t begin = 0; begin < n;) {
+			size_t end = begin + 1;
+			while (end < n && orderedBindings[end]->mSetId == orderedBindings[begin]->mSetId) {
+				++end;
+			}
+			layouts.emplace_back(get_or_alloc_layout(orderedBindings + begin, orderedBindings + end));
+			bindingsOfSet.clear();
+			for (size_t i = begin; i < end; ++i) {
+				bindingsOfSet.push_back(*orderedBindings[i]);
+			}
+			aResult.push_back(descriptor_set::prepare(std::begin(bindingsOfSet), std::end(bindingsOfSet)));
+			begin = end;
+		}
+		if (layouts.empty()) {
+			return;
+		}
+
+		// Allocate all of them at once from the current frame's pools:
+		const auto allocRequest = descriptor_alloc_request{ layouts };
+		const auto* pool = &pool_for(allocRequest);
+		std::vector<vk::DescriptorSet> setHandles;
+		auto allocResult = (*pool)->try_allocate(layouts, setHandles);
+		if (vk::Result::eErrorOutOfPoolMemory == allocResult || vk::Result::eErrorFragmentedPool == allocResult) {
+			// The pool is fragmented => move on to a new one:
+			AVK_LOG_INFO("Failed to allocate descriptor sets from a pool of '" + mName + "' (" + vk::to_string(allocResult) + "), trying again with a new pool.");
+			pool = &add_pool(allocRequest);
+			allocResult = (*pool)->try_allocate(layouts, setHandles);
+		}
+		if (vk::Result::eSuccess != allocResult) {
+			throw avk::runtime_error("Failed to allocate descriptor sets for descriptor_ring '" + mName + "': " + vk::to_string(allocResult));
+		}
+		assert(setHandles.size() == aResult.size());
+
+		for (size_t i = 0; i < aResult.size(); ++i) {
+			aResult[i].link_to_handle_and_pool(setHandles[i], *pool);
+			aResult[i].write_descriptors(layouts[i]);
 		}
 	}
 
-	fence root::create_fence(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, bool aCreateInSignalledState, std::function<void(fence_t&)> aAlterConfigBeforeCreation)
+	const descriptor_set_layout& descriptor_ring::get_or_alloc_layout(const binding_data* const* aBegin, const binding_data* const* aEnd)
 	{
-		fence_t result;
-		result.mCreateInfo = vk::FenceCreateInfo()
-			.setFlags(aCreateInSignalledState
-						? vk::FenceCreateFlagBits::eSignaled
-						: vk::FenceCreateFlags()
-			);
+		const auto n = static_cast<size_t>(aEnd - aBegin);
+		// Same hash as std::hash<descriptor_set_layout>:
+		size_t hash = 0;
+		for (auto it = aBegin; it != aEnd; ++it) {
+			const auto& binding = (*it)->mLayoutBinding;
+			hash_combine(hash, binding.binding, binding.descriptorType, binding.descriptorCount, static_cast<VkShaderStageFlags>(binding.stageFlags), binding.pImmutableSamplers, static_cast<VkDescriptorBindingFlags>((*it)->mBindingFlags));
+		}
 
-		// Maybe alter the config?
-		if (aAlterConfigBeforeCreation) {
-			aAlterConfigBeforeCreation(result);
+		const auto [first, last] = mLayouts.equal_range(hash);
+		for (auto it = first; it != last; ++it) {
+			const auto& candidate = it->second;
+			if (candidate.number_of_bindings() != n) {
+				continue;
+			}
+			bool same = true;
+			for (size_t i = 0; same && i < n; ++i) {
+				same = candidate.binding_at(i) == aBegin[i]->mLayoutBinding && candidate.binding_flags_at(i) == aBegin[i]->mBindingFlags;
+			}
+			if (same) {
+				return candidate;
+			}
 		}
 
-		result.mFence = aDevice.createFenceUnique(result.mCreateInfo, nullptr, aDispatchLoader);
-		return result;
+		std::vector<binding_data> bindings;
+		for (auto it = aBegin; it != aEnd; ++it) {
+			bindings.push_back(**it);
+		}
+		auto layout = descriptor_set_layout::prepare(std::begin(bindings), std::end(bindings));
+		root::allocate_descriptor_set_layout(mRoot->device(), mRoot->dispatch_loader_core(), layout);
+		root::allocate_descriptor_update_template(mRoot->device(), mRoot->dispatch_loader_core(), layout);
+		return mLayouts.emplace(hash, std::move(layout))->second;
 	}
 
-	fence root::create_fence(bool aCreateInSignalledState, std::function<void(fence_t&)> aAlterConfigBeforeCreation)
+	const std::shared_ptr<descriptor_pool>& descriptor_ring::pool_for(const descriptor_alloc_request& aAllocRequest)
 	{
-		return create_fence(device(), dispatch_loader_core(), aCreateInSignalledState, std::move(aAlterConfigBeforeCreation));
+		auto& frame = mFrames[mCurrentFrameIndex];
+		// Bump allocation: never go back to the pools before the current one
+		for (; frame.mCurrentPool < frame.mPools.size(); ++frame.mCurrentPool) {
+			if (frame.mPools[frame.mCurrentPool]->has_capacity_for(aAllocRequest)) {
+				return frame.mPools[frame.mCurrentPool];
+			}
+		}
+		return add_pool(aAllocRequest);
 	}
-#pragma endregion
 
-#pragma region framebuffer definitions
-	void root::check_and_config_attachments_based_on_views(std::vector<attachment>& aAttachments, std::vector<resource_ownership<image_view_t>>& aImageViews)
+	const std::shared_ptr<descriptor_pool>& descriptor_ring::add_pool(const descriptor_alloc_request& aAllocRequest)
 	{
-		if (aAttachments.size() != aImageViews.size()) {
-			throw avk::runtime_error("Incomplete config for framebuffer creation: number of attachments (" + std::to_string(aAttachments.size()) + ") does not equal the number of image views (" + std::to_string(aImageViews.size()) + ")");
-		}
-		auto n = aAttachments.size();
-		for (size_t i = 0; i < n; ++i) {
-			auto& a = aAttachments[i];
-			auto& v = aImageViews[i];
-			if ((is_depth_format(v->get_image().format()) || has_stencil_component(v->get_image().format())) && !a.is_used_as_depth_stencil_attachment()) {
-				AVK_LOG_WARNING("Possibly misconfigured framebuffer: image[" + std::to_string(i) + "] is a depth/stencil format, but it is never indicated to be used as such in the attachment-description[" + std::to_string(i) + "].");
+		// Let the capacities of new pools grow s.t. they can hold mSetsPerPool sets like the requested ones:
+		const auto numSets = std::max(aAllocRequest.num_sets(), 1u);
+		const auto setsPerPool = std::max(mSetsPerPool, numSets);
+		for (const auto& required : aAllocRequest.accumulated_pool_sizes()) {
+			const auto count = (required.descriptorCount + numSets - 1u) / numSets * setsPerPool;
+			auto it = std::lower_bound(std::begin(mPoolSizes), std::end(mPoolSizes), required,
+				[](const vk::DescriptorPoolSize& first, const vk::DescriptorPoolSize& second) -> bool {
+					using EnumType = std::underlying_type<vk::DescriptorType>::type;
+					return static_cast<EnumType>(first.type) < static_cast<EnumType>(second.type);
+				});
+			if (it != std::end(mPoolSizes) && it->type == required.type) {
+				it->descriptorCount = std::max(it->descriptorCount, count);
 			}
-			// TODO: Maybe further checks?
-			if (!a.mImageUsageHintBefore.has_value() && !a.mImageUsageHintAfter.has_value()) {
-				a.mImageUsageHintAfter = a.mImageUsageHintBefore = v->get_image().usage_config();
+			else {
+				mPoolSizes.insert(it, vk::DescriptorPoolSize{ required.type, count });
 			}
 		}
+
+		auto& frame = mFrames[mCurrentFrameIndex];
+		AVK_LOG_INFO("Allocating new descriptor pool #" + std::to_string(frame.mPools.size()) + " for frame slot " + std::to_string(mCurrentFrameIndex) + " of '" + mName + "'");
+		frame.mPools.push_back(std::make_shared<descriptor_pool>(root::create_descriptor_pool(mRoot->device(), mRoot->dispatch_loader_core(), mPoolSizes, static_cast<int>(setsPerPool))));
+		frame.mCurrentPool = frame.mPools.size() - 1;
+		return frame.mPools.back();
 	}
+#pragma endregion
 
-	framebuffer root::create_framebuffer(resource_ownership<renderpass_t> aRenderpass, std::vector<resource_ownership<image_view_t>> aImageViews, uint32_t aWidth, uint32_t aHeight, std::function<void(framebuffer_t&)> aAlterConfigBeforeCreation)
+#pragma region bindless table definitions
+	uint32_t bindless_table::slot_allocator::allocate()
 	{
-		framebuffer_t result;
-		result.mRenderpass = aRenderpass.own(); // move
-		result.mImageViews.reserve(aImageViews.size());
-		for (auto& iv : aImageViews) {
-			result.mImageViews.emplace_back(iv.own()); // move
+		if (!mFree.empty()) {
+			const auto index = mFree.back();
+			mFree.pop_back();
+			mInUse[index] = true;
+			return index;
 		}
+		if (mNextUnused < mCapacity) {
+			mInUse.push_back(true);
+			return mNextUnused++;
+		}
+		throw avk::runtime_error("All " + std::to_string(mCapacity) + " slots of a bindless table's array are in use. (Removed slots only become available again after frames in flight.)");
+	}
 
-		std::vector<vk::ImageView> imageViewHandles;
-		for (const auto& iv : result.mImageViews) {
-			imageViewHandles.push_back(iv->handle());
+	void bindless_table::slot_allocator::release(uint32_t aIndex, uint64_t aFrameId)
+	{
+		// Releasing a slot twice would put it on the free list twice, s.t. it would be handed out to two resources:
+		if (aIndex >= mNextUnused || !mInUse[aIndex]) {
+			throw avk::logic_error("Slot " + std::to_string(aIndex) + " of a bindless table's array is not in use. Has it been removed already?");
 		}
+		mInUse[aIndex] = false;
+		mReleased.emplace_back(aFrameId, aIndex);
+	}
 
-		result.mCreateInfo = vk::FramebufferCreateInfo{}
+	void bindless_table::slot_allocator::recycle_released_until(uint64_t aLastCompletedFrame)
+	{
+		while (!mReleased.empty() && std::get<uint64_t>(mReleased.front()) <= aLastCompletedFrame) {
+			mFree.push_back(std::get<uint32_t>(mReleased.front()));
+			mReleased.pop_front();
+		}
+	}
+
+	void bindless_table::write(uint32_t aBinding, uint32_t aIndex, const vk::DescriptorImageInfo* aImageInfo, const vk::DescriptorBufferInfo* aBufferInfo)
+	{
+		// One element of the array. Thanks to eUpdateUnusedWhilePending, this is fine even while the set is in use:
+		const auto write = vk::WriteDescriptorSet{}
+			.setDstSet(mDescriptorSet.handle())
+			.setDstBinding(aBinding)
+			.setDstArrayElement(aIndex)
+			.setDescriptorCount(1u)
+			.setDescriptorType(mLayout.binding_at(aBinding).descriptorType)
+			.setPImageInfo(aImageInfo)
+			.setPBufferInfo(aBufferInfo);
+		mRoot->device().updateDescriptorSets(1u, &write, 0u, nullptr, mRoot->dispatch_loader_core());
+	}
+
+	uint32_t bindless_table::add(const image_view_t& aImageView)
+	{
+		std::scoped_lock guard(*mMutex);
+		const auto index = mImageSlots.allocate();
+		write(image_binding_id, index, &aImageView.descriptor_info(), nullptr);
+		return index;
+	}
+
+	uint32_t bindless_table::add(const buffer_t& aBuffer)
+	{
+		std::scoped_lock guard(*mMutex);
+		const auto index = mBufferSlots.allocate();
+		write(buffer_binding_id, index, nullptr, &aBuffer.descriptor_info());
+		return index;
+	}
+
+	uint32_t bindless_table::add(const sampler_t& aSampler)
+	{
+		std::scoped_lock guard(*mMutex);
+		const auto index = mSamplerSlots.allocate();
+		write(sampler_binding_id, index, &aSampler.descriptor_info(), nullptr);
+		return index;
+	}
+
+	void bindless_table::remove_image(uint32_t aIndex)
+	{
+		std::scoped_lock guard(*mMutex);
+		mImageSlots.release(aIndex, mCurrentFrame);
+	}
+
+	void bindless_table::remove_buffer(uint32_t aIndex)
+	{
+		std::scoped_lock guard(*mMutex);
+		mBufferSlots.release(aIndex, mCurrentFrame);
+	}
+
+	void bindless_table::remove_sampler(uint32_t aIndex)
+	{
+		std::scoped_lock guard(*mMutex);
+		mSamplerSlots.release(aIndex, mCurrentFrame);
+	}
+
+	void bindless_table::begin_frame(uint64_t aFrameId)
+	{
+		std::scoped_lock guard(*mMutex);
+		mCurrentFrame = aFrameId;
+		if (aFrameId < mFramesInFlight) {
+			return;
+		}
+		// All frames up to this one have completed => nothing refers to the slots released during them anymore:
+		const auto lastCompletedFrame = aFrameId - mFramesInFlight;
+		mImageSlots.recycle_released_until(lastCompletedFrame);
+		mBufferSlots.recycle_released_until(lastCompletedFrame);
+		mSamplerSlots.recycle_released_until(lastCompletedFrame);
+	}
+#pragma endregion
+
+#pragma region descriptor buffer definitions
+#if VK_HEADER_VERSION >= 235
+	namespace
+	{
+		// Invokes aFunc with a vk::DescriptorGetInfoEXT for one single resource. The get-info points to data which
+		// is only valid during the invocation:
+		template <typename R, typename F>
+		void get_descriptor_info_of(const R* aResource, vk::DescriptorType aType, const root& aRoot, F& aFunc)
+		{
+			const auto bufferAddress = [&aRoot](vk::Buffer aBuffer) {
+				return aRoot.device().getBufferAddress(vk::BufferDeviceAddressInfo{}.setBuffer(aBuffer), aRoot.dispatch_loader_ext());
+			};
+			const auto pointToAddressInfo = [aType](vk::DescriptorDataEXT& aData, const vk::DescriptorAddressInfoEXT* aAddressInfo) {
+				switch (aType) {
+				case vk::DescriptorType::eUniformTexelBuffer:	aData.pUniformTexelBuffer = aAddressInfo; break;
+				case vk::DescriptorType::eStorageTexelBuffer:	aData.pStorageTexelBuffer = aAddressInfo; break;
+				case vk::DescriptorType::eUniformBuffer:		aData.pUniformBuffer = aAddressInfo; break;
+				default:										aData.pStorageBuffer = aAddressInfo; break;
+				}
+			};
+
+			vk::DescriptorDataEXT data;
+			if constexpr (std::is_same_v<R, top_level_acceleration_structure_t>) {
+				data.accelerationStructure = aRoot.device().getAccelerationStructureAddressKHR(vk::AccelerationStructureDeviceAddressInfoKHR{}.setAccelerationStructure(aResource->acceleration_structure_handle()), aRoot.dispatch_loader_ext());
+				aFunc(vk::DescriptorGetInfoEXT{ aType, data });
+			}
+			else if constexpr (std::is_same_v<R, buffer_view_t>) {
+				const auto& createInfo = aResource->create_info();
+				const auto range = VK_WHOLE_SIZE == createInfo.range ? aResource->buffer_create_info().size - createInfo.offset : createInfo.range;
+				const auto addressInfo = vk::DescriptorAddressInfoEXT{ bufferAddress(aResource->buffer_handle()) + createInfo.offset, range, createInfo.format };
+				pointToAddressInfo(data, &addressInfo);
+				aFunc(vk::DescriptorGetInfoEXT{ aType, data });
+			}
+			else if constexpr (std::is_same_v<R, buffer_view_descriptor>) {
+				const auto& info = aResource->descriptor_info();
+				const auto addressInfo = vk::DescriptorAddressInfoEXT{ bufferAddress(info.buffer) + info.offset, info.range, aResource->format() };
+				pointToAddressInfo(data, &addressInfo);
+				aFunc(vk::DescriptorGetInfoEXT{ aType, data });
+			}
+			else if constexpr (std::is_same_v<std::decay_t<decltype(aResource->descriptor_info())>, vk::DescriptorBufferInfo>) {
+				const auto& info = aResource->descriptor_info();
+				vk::DeviceAddress address;
+				if constexpr (std::is_same_v<R, buffer_t>) {
+					address = aResource->has_device_address() ? aResource->device_address() : bufferAddress(info.buffer);
+				}
+				else {
+					address = bufferAddress(info.buffer);
+				}
+				const auto addressInfo = vk::DescriptorAddressInfoEXT{ address + info.offset, info.range };
+				pointToAddressInfo(data, &addressInfo);
+				aFunc(vk::DescriptorGetInfoEXT{ aType, data });
+			}
+			else {
+				const vk::DescriptorImageInfo& info = aResource->descriptor_info();
+				switch (aType) {
+				case vk::DescriptorType::eSampler:				data.pSampler = &info.sampler; break;
+				case vk::DescriptorType::eCombinedImageSampler:	data.pCombinedImageSampler = &info; break;
+				case vk::DescriptorType::eStorageImage:			data.pStorageImage = &info; break;
+				case vk::DescriptorType::eInputAttachment:		data.pInputAttachmentImage = &info; break;
+				default:										data.pSampledImage = &info; break;
+				}
+				aFunc(vk::DescriptorGetInfoEXT{ aType, data });
+			}
+		}
+	}
+
+	void descriptor_buffer::begin_frame(uint64_t aFrameId)
+	{
+		mCurrentFrameIndex = static_cast<size_t>(aFrameId % mFramesInFlight);
+		mFrameOffset = 0;
+	}
+
+	vk::DeviceSize descriptor_buffer::write_descriptor_set(const shared_pipeline_layout& aLayout, uint32_t aSetId, const binding_data* const* aBegin, const binding_data* const* aEnd)
+	{
+		if (aSetId >= aLayout.set_layouts().size()) {
+			throw avk::runtime_error("The pipeline layout has no set with id " + std::to_string(aSetId) + ".");
+		}
+		if (!static_cast<bool>(aLayout.set_layout_create_flags()[aSetId] & vk::DescriptorSetLayoutCreateFlagBits::eDescriptorBufferEXT)) {
+			throw avk::logic_error("The layout of set " + std::to_string(aSetId) + " has not been created for descriptor buffers. Create the pipeline with cfg::pipeline_settings::descriptor_buffer.");
+		}
+
+		auto& info = info_for(aLayout.set_layouts()[aSetId]);
+		std::byte* const setData = mMappedData + allocate(info.mSize);
+		for (auto it = aBegin; it != aEnd; ++it) {
+			const auto& binding = **it;
+			const auto type = binding.mLayoutBinding.descriptorType;
+			const auto size = descriptor_size(type);
+			// Array elements are tightly packed, starting at the binding's offset:
+			std::byte* dst = setData + binding_offset(info, binding.mLayoutBinding.binding);
+			auto writeDescriptor = [this, size, &dst](const vk::DescriptorGetInfoEXT& aGetInfo) {
+				mRoot->device().getDescriptorEXT(&aGetInfo, size, dst, mRoot->dispatch_loader_ext());
+				dst += size;
+			};
+			std::visit([this, type, &writeDescriptor](const auto& aResource) {
+				using T = std::decay_t<decltype(aResource)>;
+				if constexpr (is_std_vector<T>::value) {
+					for (const auto* r : aResource) {
+						get_descriptor_info_of(r, type, *mRoot, writeDescriptor);
+					}
+				}
+				else if constexpr (!std::is_same_v<T, std::monostate>) {
+					get_descriptor_info_of(aResource, type, *mRoot, writeDescriptor);
+				}
+			}, binding.mResourcePtr);
+		}
+		return static_cast<vk::DeviceSize>(setData - mMappedData);
+	}
+
+	descriptor_buffer::set_layout_info& descriptor_buffer::info_for(const layout_registry::descriptor_set_layout_handle& aLayout)
+	{
+		const auto handle = static_cast<VkDescriptorSetLayout>(aLayout->get());
+		auto it = mSetLayoutInfos.find(handle);
+		if (std::end(mSetLayoutInfos) == it) {
+			set_layout_info info;
+			info.mLayout = aLayout;
+			info.mSize = mRoot->device().getDescriptorSetLayoutSizeEXT(aLayout->get(), mRoot->dispatch_loader_ext());
+			it = mSetLayoutInfos.emplace(handle, std::move(info)).first;
+		}
+		return it->second;
+	}
+
+	vk::DeviceSize descriptor_buffer::binding_offset(set_layout_info& aInfo, uint32_t aBinding)
+	{
+		auto it = std::lower_bound(std::begin(aInfo.mBindingOffsets), std::end(aInfo.mBindingOffsets), aBinding, [](const std::tuple<uint32_t, vk::DeviceSize>& aEntry, uint32_t aId) {
+			return std::get<uint32_t>(aEntry) < aId;
+		});
+		if (std::end(aInfo.mBindingOffsets) == it || std::get<uint32_t>(*it) != aBinding) {
+			const auto offset = mRoot->device().getDescriptorSetLayoutBindingOffsetEXT(aInfo.mLayout->get(), aBinding, mRoot->dispatch_loader_ext());
+			it = aInfo.mBindingOffsets.emplace(it, aBinding, offset);
+		}
+		return std::get<vk::DeviceSize>(*it);
+	}
+
+	size_t descriptor_buffer::descriptor_size(vk::DescriptorType aType) const
+	{
+		switch (aType) {
+		case vk::DescriptorType::eSampler:					return mProperties.samplerDescriptorSize;
+		case vk::DescriptorType::eCombinedImageSampler:		return mProperties.combinedImageSamplerDescriptorSize;
+		case vk::DescriptorType::eSampledImage:				return mProperties.sampledImageDescriptorSize;
+		case vk::DescriptorType::eStorageImage:				return mProperties.storageImageDescriptorSize;
+		case vk::DescriptorType::eInputAttachment:			return mProperties.inputAttachmentDescriptorSize;
+		case vk::DescriptorType::eAccelerationStructureKHR:	return mProperties.accelerationStructureDescriptorSize;
+		case vk::DescriptorType::eUniformTexelBuffer:		return mRobustBufferAccess ? mProperties.robustUniformTexelBufferDescriptorSize : mProperties.uniformTexelBufferDescriptorSize;
+		case vk::DescriptorType::eStorageTexelBuffer:		return mRobustBufferAccess ? mProperties.robustStorageTexelBufferDescriptorSize : mProperties.storageTexelBufferDescriptorSize;
+		case vk::DescriptorType::eUniformBuffer:			return mRobustBufferAccess ? mProperties.robustUniformBufferDescriptorSize : mProperties.uniformBufferDescriptorSize;
+		case vk::DescriptorType::eStorageBuffer:			return mRobustBufferAccess ? mProperties.robustStorageBufferDescriptorSize : mProperties.storageBufferDescriptorSize;
+		default:
+			throw avk::runtime_error("Descriptors of type " + vk::to_string(aType) + " can not be written into descriptor buffers.");
+		}
+	}
+
+	vk::DeviceSize descriptor_buffer::allocate(vk::DeviceSize aSize)
+	{
+		const auto alignment = mProperties.descriptorBufferOffsetAlignment;
+		const auto offset = (mFrameOffset + alignment - 1) / alignment * alignment;
+		if (offset + aSize > mBytesPerFrame) {
+			throw avk::runtime_error("The current frame's region of the descriptor buffer is exhausted. Create the descriptor buffer with more bytes per frame.");
+		}
+		mFrameOffset = offset + aSize;
+		return static_cast<vk::DeviceSize>(mCurrentFrameIndex) * mBytesPerFrame + offset;
+	}
+#endif
+#pragma endregion
+
+#pragma region fence definitions
+	fence_t::~fence_t()
+	{
+		// If there are custom deleters => call them now
+		invoke_in_reverse_order_and_clear(mCustomDeleters);
+		if (mPool && mFence) {
+			mPool->give_back(mFence.release());
+		}
+		// Destroy the dependant instance before destroying myself
+		// ^ This is ensured by the order of the members
+		//   See: https://isocpp.org/wiki/faq/dtors#calling-member-dtors
+	}
+
+	fence_t& fence_t::set_designated_queue(queue& _Queue)
+	{
+		mQueue = &_Queue;
+		return *this;
+	}
+
+	void fence_t::wait_until_signalled(std::optional<uint64_t> aTimeout) const
+	{
+		// ReSharper disable once CppExpressionWithoutSideEffects
+		auto result = mFence.getOwner().waitForFences(1u, handle_ptr(), VK_TRUE, aTimeout.value_or(UINT64_MAX));
+		assert(static_cast<VkResult>(result) >= 0);
+	}
+
+	bool fence_t::is_signalled() const
+	{
+		return vk::Result::eSuccess == mFence.getOwner().getFenceStatus(handle());
+	}
+
+	std::vector<size_t> fence_t::poll(const std::vector<resource_reference<const fence_t>>& aFences)
+	{
+		std::vector<size_t> signalled;
+		for (size_t i = 0; i < aFences.size(); ++i) {
+			if (aFences[i]->is_signalled()) {
+				signalled.push_back(i);
+			}
+		}
+		return signalled;
+	}
+
+	void fence_t::reset()
+	{
+		// ReSharper disable once CppExpressionWithoutSideEffects
+		mFence.getOwner().resetFences(1u, handle_ptr());
+		// If there are custom deleters => call them now
+		invoke_in_reverse_order_and_clear(mCustomDeleters);
+	}
+
+	fence root::create_fence(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, bool aCreateInSignalledState, std::function<void(fence_t&)> aAlterConfigBeforeCreation)
+	{
+		fence_t result;
+		result.mCreateInfo = vk::FenceCreateInfo()
+			.setFlags(aCreateInSignalledState
+						? vk::FenceCreateFlagBits::eSignaled
+						: vk::FenceCreateFlags()
+			);
+
+		// Maybe alter the config?
+		if (aAlterConfigBeforeCreation) {
+			aAlterConfigBeforeCreation(result);
+		}
+
+		result.mFence = aDevice.createFenceUnique(result.mCreateInfo, nullptr, aDispatchLoader);
+		return result;
+	}
+
+	fence root::create_fence(bool aCreateInSignalledState, std::function<void(fence_t&)> aAlterConfigBeforeCreation)
+	{
+		return create_fence(device(), dispatch_loader_core(), aCreateInSignalledState, std::move(aAlterConfigBeforeCreation));
+	}
+
+	fence_pool::fence_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader)
+		: mDevice{ aDevice }
+		, mDispatchLoader{ &aDispatchLoader }
+	{
+	}
+
+	fence_pool::~fence_pool()
+	{
+		// No fence_t refers to this pool anymore, otherwise it would still be alive. I.e., all fences
+		// which have not been destroyed by their owners (see fence_t::mPool) have been returned:
+		for (auto f : mAvailable) {
+			mDevice.destroyFence(f, nullptr, *mDispatchLoader);
+		}
+		for (auto f : mReturned) {
+			mDevice.destroyFence(f, nullptr, *mDispatchLoader);
+		}
+	}
+
+	fence fence_pool::acquire()
+	{
+		vk::Fence handle;
+		{
+			std::scoped_lock guard(mMutex);
+			if (mAvailable.empty()) {
+				recycle_signalled_fences_locked();
+			}
+			if (!mAvailable.empty()) {
+				handle = mAvailable.back();
+				mAvailable.pop_back();
+			}
+			else {
+				handle = mDevice.createFence(vk::FenceCreateInfo{}, nullptr, *mDispatchLoader);
+				++mNumberOfFences;
+			}
+		}
+
+		fence_t result;
+		result.mCreateInfo = vk::FenceCreateInfo{};
+		result.mFence = vk::UniqueHandle<vk::Fence, DISPATCH_LOADER_CORE_TYPE>(handle, vk::ObjectDestroy<vk::Device, DISPATCH_LOADER_CORE_TYPE>(mDevice, nullptr, *mDispatchLoader));
+		result.mPool = shared_from_this();
+		return result;
+	}
+
+	void fence_pool::recycle_signalled_fences()
+	{
+		std::scoped_lock guard(mMutex);
+		recycle_signalled_fences_locked();
+	}
+
+	void fence_pool::recycle_signalled_fences_locked()
+	{
+		std::vector<vk::Fence> signalled;
+		for (auto it = std::begin(mReturned); it != std::end(mReturned);) {
+			if (vk::Result::eSuccess == mDevice.getFenceStatus(*it, *mDispatchLoader)) {
+				signalled.push_back(*it);
+				it = mReturned.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+		if (!signalled.empty()) {
+			// Reset them all at once:
+			mDevice.resetFences(signalled, *mDispatchLoader);
+			mAvailable.insert(std::end(mAvailable), std::begin(signalled), std::end(signalled));
+		}
+	}
+
+	void fence_pool::give_back(vk::Fence aFence)
+	{
+		std::scoped_lock guard(mMutex);
+		mReturned.push_back(aFence);
+	}
+
+	size_t fence_pool::number_of_fences() const
+	{
+		std::scoped_lock guard(mMutex);
+		return mNumberOfFences;
+	}
+
+	size_t fence_pool::number_of_available_fences() const
+	{
+		std::scoped_lock guard(mMutex);
+		return mAvailable.size();
+	}
+#pragma endregion
+
+#pragma region framebuffer definitions
+	void root::check_and_config_attachments_based_on_views(std::vector<attachment>& aAttachments, std::vector<resource_ownership<image_view_t>>& aImageViews)
+	{
+		if (aAttachments.size() != aImageViews.size()) {
+			throw avk::runtime_error("Incomplete config for framebuffer creation: number of attachments (" + std::to_string(aAttachments.size()) + ") does not equal the number of image views (" + std::to_string(aImageViews.size()) + ")");
+		}
+		auto n = aAttachments.size();
+		for (size_t i = 0; i < n; ++i) {
+			auto& a = aAttachments[i];
+			auto& v = aImageViews[i];
+			if ((is_depth_format(v->get_image().format()) || has_stencil_component(v->get_image().format())) && !a.is_used_as_depth_stencil_attachment()) {
+				AVK_LOG_WARNING("Possibly misconfigured framebuffer: image[" + std::to_string(i) + "] is a depth/stencil format, but it is never indicated to be used as such in the attachment-description[" + std::to_string(i) + "].");
+			}
+			// TODO: Maybe further checks?
+			if (!a.mImageUsageHintBefore.has_value() && !a.mImageUsageHintAfter.has_value()) {
+				a.mImageUsageHintAfter = a.mImageUsageHintBefore = v->get_image().usage_config();
+			}
+		}
+	}
+
+	framebuffer root::create_framebuffer(resource_ownership<renderpass_t> aRenderpass, std::vector<resource_ownership<image_view_t>> aImageViews, uint32_t aWidth, uint32_t aHeight, std::function<void(framebuffer_t&)> aAlterConfigBeforeCreation)
+	{
+		framebuffer_t result;
+		result.mRenderpass = aRenderpass.own(); // move
+		result.mImageViews.reserve(aImageViews.size());
+		for (auto& iv : aImageViews) {
+			result.mImageViews.emplace_back(iv.own()); // move
+		}
+
+		std::vector<vk::ImageView> imageViewHandles;
+		for (const auto& iv : result.mImageViews) {
+			imageViewHandles.push_back(iv->handle());
+		}
+
+		result.mCreateInfo = vk::FramebufferCreateInfo{}
 			.setRenderPass(result.mRenderpass->handle())
 			.setAttachmentCount(static_cast<uint32_t>(imageViewHandles.size()))
 			.setPAttachments(imageViewHandles.data())
@@ -4400,6 +6710,9 @@ namespace avk
 		, mDepthBoundsConfig{ cfg::depth_bounds::disable() }
 		, mColorBlendingSettings{ cfg::color_blending_settings::disable_logic_operation() }
 		, mTessellationPatchControlPoints {}
+#if VK_HEADER_VERSION >= 204
+		, mDynamicStates{ cfg::dynamic_state::none } // all states baked into the pipeline
+#endif
 	{
 	}
 
@@ -4425,6 +6738,7 @@ namespace avk
 #pragma region graphics pipeline definitions
 	void root::rewire_config_and_create_graphics_pipeline(graphics_pipeline_t& aPreparedPipeline)
 	{
+		begin_creation_feedback(aPreparedPipeline.mCreationFeedback);
 		aPreparedPipeline.mPipelineVertexInputStateCreateInfo
 			.setPVertexBindingDescriptions(aPreparedPipeline.mOrderedVertexInputBindingDescriptions.data())
 			.setPVertexAttributeDescriptions(aPreparedPipeline.mVertexInputAttributeDescriptions.data());
@@ -4463,10 +6777,23 @@ namespace avk
 
 		// Pipeline Layout must be rewired already before calling this function
 
-		// Create the PIPELINE LAYOUT
-		aPreparedPipeline.mPipelineLayout = device().createPipelineLayoutUnique(aPreparedPipeline.mPipelineLayoutCreateInfo, nullptr, dispatch_loader_core());
+		// Create the PIPELINE LAYOUT, or reuse an identical one
+		aPreparedPipeline.mPipelineLayout = timed(aPreparedPipeline.mCreationFeedback.mLayoutCreationDuration, [&] {
+			return global_layout_registry().get_or_create_pipeline_layout(device(), dispatch_loader_core(), aPreparedPipeline.mAllDescriptorSetLayouts, aPreparedPipeline.mPushConstantRanges, aPreparedPipeline.mPipelineLayoutCreateInfo.flags);
+		});
+		aPreparedPipeline.mPipelineLayoutCreateInfo = aPreparedPipeline.mPipelineLayout->create_info();
 		assert(static_cast<bool>(aPreparedPipeline.layout_handle()));
 
+#if VK_HEADER_VERSION >= 213
+		// Fast-link the PIPELINE from pipeline libraries instead of compiling it monolithically?
+		if (nullptr != aPreparedPipeline.mPipelineLibraryCache) {
+			timed(aPreparedPipeline.mCreationFeedback.mPipelineCreationDuration, [&] { create_graphics_pipeline_from_libraries(aPreparedPipeline, *aPreparedPipeline.mPipelineLibraryCache); });
+			// Driver feedback of the final link (if requested) has been stored by create_graphics_pipeline_from_libraries:
+			finish_creation_feedback(aPreparedPipeline.mCreationFeedback, {}, references_to(aPreparedPipeline.mShaders), "graphics (linked from libraries)");
+			return;
+		}
+#endif
+
 		// Create the PIPELINE, a.k.a. putting it all together:
 		auto pipelineInfo = vk::GraphicsPipelineCreateInfo{}
 			// 0. Render Pass
@@ -4506,12 +6833,20 @@ namespace avk
 
 		// TODO: Shouldn't the config be altered HERE, after the pipelineInfo has been compiled?!
 
+		std::optional<driver_feedback_request> driverFeedback;
+		if (pipeline_creation_statistics::is_driver_feedback_enabled()) {
+			driverFeedback.emplace(static_cast<uint32_t>(aPreparedPipeline.mShaderStageCreateInfos.size()));
+			pipelineInfo.setPNext(&driverFeedback->mCreateInfo);
+		}
+		const auto pipelineCreationStart = std::chrono::steady_clock::now();
 #if VK_HEADER_VERSION >= 141
 		auto result = device().createGraphicsPipelineUnique(nullptr, pipelineInfo, nullptr, dispatch_loader_core());
 		aPreparedPipeline.mPipeline = std::move(result.value);
 #else
 		aPreparedPipeline.mPipeline = device().createGraphicsPipelineUnique(nullptr, pipelineInfo);
 #endif
+		aPreparedPipeline.mCreationFeedback.mPipelineCreationDuration += elapsed_since(pipelineCreationStart);
+		finish_creation_feedback(aPreparedPipeline.mCreationFeedback, driverFeedback, references_to(aPreparedPipeline.mShaders), "graphics");
 	}
 
 	// Unfortunately C++20 does not have support to easily convert a range into a vector through chaining, so we have to
@@ -4628,7 +6963,7 @@ namespace avk
 				throw avk::runtime_error("There's already a " + vk::to_string(to_vk_shader_stages(shaderInfo.mShaderType)) + "-type shader contained in this graphics pipeline. Can not add another one of the same type.");
 			}
 			// 5.1 Compile the shader
-			result.mShaders.push_back(create_shader(shaderInfo));
+			result.mShaders.push_back(timed(result.mCreationFeedback.mShaderLoadDuration, [&] { return create_shader(shaderInfo); }));
 			assert(result.mShaders.back().has_been_built());
 			// 5.2 Combine
 			auto& stageCreateInfo = result.mShaderStageCreateInfos.emplace_back()
@@ -4867,6 +7202,38 @@ namespace avk
 				result.mDynamicStateEntries.push_back(vk::DynamicState::eStencilReference);
 				result.mDynamicStateEntries.push_back(vk::DynamicState::eStencilWriteMask);
 			}
+#if VK_HEADER_VERSION >= 204
+			// Check for extended dynamic states
+			{
+				const std::array<std::tuple<cfg::dynamic_state, vk::DynamicState>, 16> extendedDynamicStates{{
+					{ cfg::dynamic_state::cull_mode,				vk::DynamicState::eCullMode },
+					{ cfg::dynamic_state::front_face,				vk::DynamicState::eFrontFace },
+					{ cfg::dynamic_state::primitive_topology,		vk::DynamicState::ePrimitiveTopology },
+					{ cfg::dynamic_state::depth_test,				vk::DynamicState::eDepthTestEnable },
+					{ cfg::dynamic_state::depth_write,				vk::DynamicState::eDepthWriteEnable },
+					{ cfg::dynamic_state::depth_compare_operation,	vk::DynamicState::eDepthCompareOp },
+					{ cfg::dynamic_state::depth_bounds_test,		vk::DynamicState::eDepthBoundsTestEnable },
+					{ cfg::dynamic_state::stencil_test,				vk::DynamicState::eStencilTestEnable },
+					{ cfg::dynamic_state::stencil_operation,		vk::DynamicState::eStencilOp },
+					{ cfg::dynamic_state::rasterizer_discard,		vk::DynamicState::eRasterizerDiscardEnable },
+					{ cfg::dynamic_state::depth_bias,				vk::DynamicState::eDepthBiasEnable },
+					{ cfg::dynamic_state::primitive_restart,		vk::DynamicState::ePrimitiveRestartEnable },
+#if VK_HEADER_VERSION >= 233
+					{ cfg::dynamic_state::polygon_mode,				vk::DynamicState::ePolygonModeEXT },
+					{ cfg::dynamic_state::depth_clamp,				vk::DynamicState::eDepthClampEnableEXT },
+					{ cfg::dynamic_state::color_blend_enable,		vk::DynamicState::eColorBlendEnableEXT },
+					{ cfg::dynamic_state::color_write_mask,			vk::DynamicState::eColorWriteMaskEXT },
+#else
+					{}, {}, {}, {}
+#endif
+				}};
+				for (const auto& [flag, dynamicState] : extendedDynamicStates) {
+					if (cfg::dynamic_state::none != flag && flag == (aConfig.mDynamicStates & flag)) {
+						result.mDynamicStateEntries.push_back(dynamicState);
+					}
+				}
+			}
+#endif
 			// TODO: Support further dynamic states
 
 			result.mDynamicStateCreateInfo = vk::PipelineDynamicStateCreateInfo{}
@@ -4880,6 +7247,11 @@ namespace avk
 		if ((aConfig.mPipelineSettings & pipeline_settings::disable_optimization) == pipeline_settings::disable_optimization) {
 			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDisableOptimization;
 		}
+#if VK_HEADER_VERSION >= 235
+		if ((aConfig.mPipelineSettings & pipeline_settings::descriptor_buffer) == pipeline_settings::descriptor_buffer) {
+			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDescriptorBufferEXT;
+		}
+#endif
 
 		// 13. Patch Control Points for Tessellation
 		if (aConfig.mTessellationPatchControlPoints.has_value()) {
@@ -4887,10 +7259,22 @@ namespace avk
 				.setPatchControlPoints(aConfig.mTessellationPatchControlPoints.value().mPatchControlPoints);
 		}
 
+#if VK_HEADER_VERSION >= 213
+		// Shall the pipeline be linked from pipeline libraries?
+		if (aConfig.mPipelineLibraryCache.has_value()) {
+			result.mPipelineLibraryCache = aConfig.mPipelineLibraryCache.value().mCache;
+		}
+#endif
+
 		// 14. Compile the PIPELINE LAYOUT data and create-info
 		// Get the descriptor set layouts
 		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings));
-		allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts);
+#if VK_HEADER_VERSION >= 235
+		if (avk::has_flag(result.mPipelineCreateFlags, vk::PipelineCreateFlagBits::eDescriptorBufferEXT)) {
+			prepare_for_descriptor_buffers(result.mAllDescriptorSetLayouts);
+		}
+#endif
+		timed(result.mCreationFeedback.mLayoutCreationDuration, [&] { allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts); });
 
 		// Gather the push constant data
 		result.mPushConstantRanges.reserve(aConfig.mPushConstantsBindings.size()); // Important! Otherwise the vector might realloc and .data() will become invalid!
@@ -4939,7 +7323,7 @@ namespace avk
 		result.mInputAssemblyStateCreateInfo			= aTemplate->mInputAssemblyStateCreateInfo		   ;
 
 		for (const auto& shdr : aTemplate->mShaders) {
-			result.mShaders.push_back(create_shader_from_template(shdr));
+			result.mShaders.push_back(timed(result.mCreationFeedback.mShaderLoadDuration, [&] { return create_shader_from_template(shdr); }));
 		}
 
 		result.mShaderStageCreateInfos					= aTemplate->mShaderStageCreateInfos					;
@@ -4955,10 +7339,13 @@ namespace avk
 		result.mDynamicStateEntries						= aTemplate->mDynamicStateEntries				   ;
 		result.mDynamicStateCreateInfo					= aTemplate->mDynamicStateCreateInfo					;
 
-		result.mAllDescriptorSetLayouts = create_set_of_descriptor_set_layouts_from_template(aTemplate->mAllDescriptorSetLayouts);
+		result.mAllDescriptorSetLayouts = timed(result.mCreationFeedback.mLayoutCreationDuration, [&] { return create_set_of_descriptor_set_layouts_from_template(aTemplate->mAllDescriptorSetLayouts); });
 
 		result.mPushConstantRanges						= aTemplate->mPushConstantRanges						;
 		result.mPipelineTessellationStateCreateInfo		= aTemplate->mPipelineTessellationStateCreateInfo  ;
+#if VK_HEADER_VERSION >= 213
+		result.mPipelineLibraryCache					= aTemplate->mPipelineLibraryCache				   ;
+#endif
 
 		auto descriptorSetLayoutHandles = result.mAllDescriptorSetLayouts.layout_handles();
 		// These uniform values (Anm.: passed to shaders) need to be specified during pipeline creation by creating a VkPipelineLayout object. [4]
@@ -4988,25 +7375,524 @@ namespace avk
 
 		return oldRenderPass;
 	}
-#pragma endregion
 
-#pragma region image definitions
-	image_t::image_t(const image_t& aOther)
+#if VK_HEADER_VERSION >= 213
+	namespace
 	{
-		if (std::holds_alternative<vk::Image>(aOther.mImage)) {
-			mCreateInfo = aOther.mCreateInfo;
-			mImage = std::get<vk::Image>(aOther.mImage);
-			mTargetLayout = aOther.mTargetLayout;
-			mCurrentLayout = aOther.mCurrentLayout;
-			mImageUsage = aOther.mImageUsage;
-			mAspectFlags = aOther.mAspectFlags;
-		}
-		else {
-			throw avk::runtime_error("Can not copy this image instance!");
-		}
-	}
-
-	image root::create_image_from_template(resource_reference<const image_t> aTemplate, std::function<void(image_t&)> aAlterConfigBeforeCreation)
+		// Serializes the values of a pipeline config which are relevant for one library into a string of bytes,
+		// s.t. cached libraries can be compared exactly instead of only by a hash. Variable-length parts are
+		// preceded by their sizes, s.t. different configs never result in the same bytes.
+		struct sub_config_writer
+		{
+			template <typename... Ts>
+			void add(const Ts&... aValues)
+			{
+				(append(aValues), ...);
+			}
+
+			std::string mBytes;
+
+		private:
+			template <typename T>
+			void append(const T& aValue)
+			{
+				static_assert(std::is_trivially_copyable_v<T>);
+				mBytes.append(reinterpret_cast<const char*>(&aValue), sizeof(T));
+			}
+
+			void append(std::string_view aValue)
+			{
+				append(aValue.size());
+				mBytes.append(aValue);
+			}
+
+			void append(const std::string& aValue)
+			{
+				append(std::string_view{ aValue });
+			}
+		};
+
+		// Everything of a renderpass' subpass which is relevant for render pass compatibility
+		void write_renderpass_subpass(sub_config_writer& aWriter, const renderpass_t& aRenderpass, uint32_t aSubpass)
+		{
+			const auto attachments = aRenderpass.attachment_descriptions();
+			auto writeRef = [&aWriter, &attachments](const vk::AttachmentReference& aRef) {
+				if (VK_ATTACHMENT_UNUSED == aRef.attachment) {
+					aWriter.add(aRef.attachment);
+				}
+				else {
+					aWriter.add(aRef.attachment, attachments[aRef.attachment].format, attachments[aRef.attachment].samples);
+				}
+			};
+			const auto& subpass = aRenderpass.subpasses()[aSubpass];
+			aWriter.add(aSubpass, subpass.inputAttachmentCount, subpass.colorAttachmentCount, nullptr != subpass.pResolveAttachments, nullptr != subpass.pDepthStencilAttachment);
+			for (uint32_t i = 0; i < subpass.inputAttachmentCount; ++i) {
+				writeRef(subpass.pInputAttachments[i]);
+			}
+			for (uint32_t i = 0; i < subpass.colorAttachmentCount; ++i) {
+				writeRef(subpass.pColorAttachments[i]);
+				if (nullptr != subpass.pResolveAttachments) {
+					writeRef(subpass.pResolveAttachments[i]);
+				}
+			}
+			if (nullptr != subpass.pDepthStencilAttachment) {
+				writeRef(*subpass.pDepthStencilAttachment);
+			}
+		}
+
+		// Pipeline layouts must be identically defined for all libraries of a pipeline
+		void write_pipeline_layout(sub_config_writer& aWriter, const set_of_descriptor_set_layouts& aSetLayouts, const std::vector<vk::PushConstantRange>& aPushConstantRanges)
+		{
+			aWriter.add(aSetLayouts.all_sets().size());
+			for (const auto& dsl : aSetLayouts.all_sets()) {
+				aWriter.add(static_cast<VkDescriptorSetLayoutCreateFlags>(dsl.create_flags()), dsl.number_of_bindings());
+				for (size_t i = 0; i < dsl.number_of_bindings(); ++i) {
+					const auto& b = dsl.binding_at(i);
+					aWriter.add(b.binding, b.descriptorType, b.descriptorCount, static_cast<VkShaderStageFlags>(b.stageFlags), b.pImmutableSamplers, static_cast<VkDescriptorBindingFlags>(dsl.binding_flags_at(i)));
+				}
+			}
+			aWriter.add(aPushConstantRanges.size());
+			for (const auto& pcr : aPushConstantRanges) {
+				aWriter.add(static_cast<VkShaderStageFlags>(pcr.stageFlags), pcr.offset, pcr.size);
+			}
+		}
+
+		void write_shader(sub_config_writer& aWriter, const shader& aShader)
+		{
+			const auto& info = aShader.info();
+			aWriter.add(transform_path_for_comparison(info.mPath), info.mShaderType, trim_spaces(info.mEntryPoint), aShader.actual_load_path(), info.mSpecializationConstants.has_value());
+			if (info.mSpecializationConstants.has_value()) {
+				aWriter.add(info.mSpecializationConstants->mMapEntries.size());
+				for (const auto& entry : info.mSpecializationConstants->mMapEntries) {
+					aWriter.add(entry.constantID, entry.offset, entry.size);
+				}
+				aWriter.add(std::string_view{ reinterpret_cast<const char*>(info.mSpecializationConstants->mData.data()), info.mSpecializationConstants->mData.size() });
+			}
+		}
+
+		void write_dynamic_states(sub_config_writer& aWriter, const std::vector<vk::DynamicState>& aDynamicStates)
+		{
+			aWriter.add(aDynamicStates.size());
+			for (auto ds : aDynamicStates) {
+				aWriter.add(ds);
+			}
+		}
+
+		void write_multisample_state(sub_config_writer& aWriter, const vk::PipelineMultisampleStateCreateInfo& aState)
+		{
+			aWriter.add(aState.rasterizationSamples, aState.sampleShadingEnable, aState.minSampleShading, aState.alphaToCoverageEnable, aState.alphaToOneEnable);
+		}
+	}
+
+	void root::create_graphics_pipeline_from_libraries(graphics_pipeline_t& aPreparedPipeline, graphics_pipeline_library_cache& aCache)
+	{
+		using part = graphics_pipeline_library_cache::part;
+		const auto& p = aPreparedPipeline;
+		const bool isMeshPipeline = std::end(p.mShaders) != std::find_if(std::begin(p.mShaders), std::end(p.mShaders), [](const shader& aShader) {
+			return shader_type::mesh == aShader.info().mShaderType;
+		});
+		const auto dynamicState = p.mDynamicStateEntries.size() == 0 ? nullptr : &p.mDynamicStateCreateInfo;
+
+		// Returns the library for the given part from the cache, or creates it with the given (partial) create info:
+		auto getOrCreateLibrary = [this, &aCache, &p](part aPart, sub_config_writer aSubConfig, vk::GraphicsPipelineLibraryFlagsEXT aLibraryFlags, vk::GraphicsPipelineCreateInfo aPartialCreateInfo) -> vk::Pipeline {
+			if (const auto* cached = aCache.find(aPart, aSubConfig.mBytes); nullptr != cached) {
+				++aCache.mCacheHits;
+				return cached->mHandle.get();
+			}
+			++aCache.mCacheMisses;
+
+			auto libraryInfo = vk::GraphicsPipelineLibraryCreateInfoEXT{}
+				.setFlags(aLibraryFlags);
+			aPartialCreateInfo
+				.setPNext(&libraryInfo)
+				.setFlags(p.mPipelineCreateFlags | vk::PipelineCreateFlagBits::eLibraryKHR | vk::PipelineCreateFlagBits::eRetainLinkTimeOptimizationInfoEXT)
+				.setBasePipelineHandle(nullptr)
+				.setBasePipelineIndex(-1);
+			auto result = device().createGraphicsPipelineUnique(nullptr, aPartialCreateInfo, nullptr, dispatch_loader_core());
+			const auto library = result.value.get();
+			const auto key = graphics_pipeline_library_cache::key_for(aPart, aSubConfig.mBytes);
+			aCache.mLibraries.emplace(key, graphics_pipeline_library_cache::library{ aPart, std::move(aSubConfig.mBytes), std::move(result.value) });
+			return library;
+		};
+
+		sub_config_writer layout;
+		write_pipeline_layout(layout, p.mAllDescriptorSetLayouts, p.mPushConstantRanges);
+		sub_config_writer renderpass;
+		write_renderpass_subpass(renderpass, *p.mRenderPass, p.mSubpassIndex);
+
+		// Split the shader stages into pre-rasterization stages and the fragment stage:
+		std::vector<vk::PipelineShaderStageCreateInfo> preRasterizationStages;
+		std::vector<vk::PipelineShaderStageCreateInfo> fragmentStages;
+		sub_config_writer preRasterizationShaders;
+		sub_config_writer fragmentShader;
+		for (size_t i = 0; i < p.mShaders.size(); ++i) {
+			if (shader_type::fragment == p.mShaders[i].info().mShaderType) {
+				fragmentStages.push_back(p.mShaderStageCreateInfos[i]);
+				write_shader(fragmentShader, p.mShaders[i]);
+			}
+			else {
+				preRasterizationStages.push_back(p.mShaderStageCreateInfos[i]);
+				write_shader(preRasterizationShaders, p.mShaders[i]);
+			}
+		}
+
+		std::vector<vk::Pipeline> libraries;
+		libraries.reserve(4);
+
+		// 1. Vertex input interface
+		if (!isMeshPipeline) {
+			sub_config_writer w;
+			w.add(p.mOrderedVertexInputBindingDescriptions.size());
+			for (const auto& b : p.mOrderedVertexInputBindingDescriptions) {
+				w.add(b.binding, b.stride, b.inputRate);
+			}
+			w.add(p.mVertexInputAttributeDescriptions.size());
+			for (const auto& a : p.mVertexInputAttributeDescriptions) {
+				w.add(a.location, a.binding, a.format, a.offset);
+			}
+			w.add(p.mInputAssemblyStateCreateInfo.topology, p.mInputAssemblyStateCreateInfo.primitiveRestartEnable, static_cast<VkPipelineCreateFlags>(p.mPipelineCreateFlags));
+			write_dynamic_states(w, p.mDynamicStateEntries);
+			libraries.push_back(getOrCreateLibrary(part::vertex_input_interface, std::move(w), vk::GraphicsPipelineLibraryFlagBitsEXT::eVertexInputInterface, vk::GraphicsPipelineCreateInfo{}
+				.setPVertexInputState(&p.mPipelineVertexInputStateCreateInfo)
+				.setPInputAssemblyState(&p.mInputAssemblyStateCreateInfo)
+				.setPDynamicState(dynamicState)
+			));
+		}
+
+		// 2. Pre-rasterization shaders
+		{
+			sub_config_writer w = preRasterizationShaders;
+			w.add(layout.mBytes, renderpass.mBytes, static_cast<VkPipelineCreateFlags>(p.mPipelineCreateFlags));
+			w.add(p.mViewports.size());
+			for (const auto& vp : p.mViewports) {
+				w.add(vp.x, vp.y, vp.width, vp.height, vp.minDepth, vp.maxDepth);
+			}
+			w.add(p.mScissors.size());
+			for (const auto& sc : p.mScissors) {
+				w.add(sc.offset.x, sc.offset.y, sc.extent.width, sc.extent.height);
+			}
+			const auto& rs = p.mRasterizationStateCreateInfo;
+			w.add(rs.depthClampEnable, rs.rasterizerDiscardEnable, rs.polygonMode, static_cast<VkCullModeFlags>(rs.cullMode), rs.frontFace,
+				rs.depthBiasEnable, rs.depthBiasConstantFactor, rs.depthBiasClamp, rs.depthBiasSlopeFactor, rs.lineWidth);
+			w.add(p.mPipelineTessellationStateCreateInfo.has_value());
+			if (p.mPipelineTessellationStateCreateInfo.has_value()) {
+				w.add(p.mPipelineTessellationStateCreateInfo.value().patchControlPoints);
+			}
+			write_dynamic_states(w, p.mDynamicStateEntries);
+
+			auto info = vk::GraphicsPipelineCreateInfo{}
+				.setStageCount(static_cast<uint32_t>(preRasterizationStages.size()))
+				.setPStages(preRasterizationStages.data())
+				.setPViewportState(&p.mViewportStateCreateInfo)
+				.setPRasterizationState(&p.mRasterizationStateCreateInfo)
+				.setPDynamicState(dynamicState)
+				.setLayout(p.layout_handle())
+				.setRenderPass(p.mRenderPass->handle())
+				.setSubpass(p.mSubpassIndex);
+			if (p.mPipelineTessellationStateCreateInfo.has_value()) {
+				info.setPTessellationState(&p.mPipelineTessellationStateCreateInfo.value());
+			}
+			libraries.push_back(getOrCreateLibrary(part::pre_rasterization_shaders, std::move(w), vk::GraphicsPipelineLibraryFlagBitsEXT::ePreRasterizationShaders, info));
+		}
+
+		// 3. Fragment shader
+		{
+			sub_config_writer w = fragmentShader;
+			w.add(layout.mBytes, renderpass.mBytes, static_cast<VkPipelineCreateFlags>(p.mPipelineCreateFlags));
+			const auto& ds = p.mDepthStencilConfig;
+			w.add(ds.depthTestEnable, ds.depthWriteEnable, ds.depthCompareOp, ds.depthBoundsTestEnable, ds.stencilTestEnable, ds.minDepthBounds, ds.maxDepthBounds);
+			for (const auto& so : { ds.front, ds.back }) {
+				w.add(so.failOp, so.passOp, so.depthFailOp, so.compareOp, so.compareMask, so.writeMask, so.reference);
+			}
+			write_multisample_state(w, p.mMultisampleStateCreateInfo);
+			write_dynamic_states(w, p.mDynamicStateEntries);
+
+			libraries.push_back(getOrCreateLibrary(part::fragment_shader, std::move(w), vk::GraphicsPipelineLibraryFlagBitsEXT::eFragmentShader, vk::GraphicsPipelineCreateInfo{}
+				.setStageCount(static_cast<uint32_t>(fragmentStages.size()))
+				.setPStages(fragmentStages.data())
+				.setPDepthStencilState(&p.mDepthStencilConfig)
+				.setPMultisampleState(&p.mMultisampleStateCreateInfo)
+				.setPDynamicState(dynamicState)
+				.setLayout(p.layout_handle())
+				.setRenderPass(p.mRenderPass->handle())
+				.setSubpass(p.mSubpassIndex)
+			));
+		}
+
+		// 4. Fragment output interface
+		{
+			sub_config_writer w = renderpass;
+			const auto& cb = p.mColorBlendStateCreateInfo;
+			w.add(static_cast<VkPipelineCreateFlags>(p.mPipelineCreateFlags), cb.logicOpEnable, cb.logicOp, cb.blendConstants[0], cb.blendConstants[1], cb.blendConstants[2], cb.blendConstants[3]);
+			w.add(p.mBlendingConfigsForColorAttachments.size());
+			for (const auto& att : p.mBlendingConfigsForColorAttachments) {
+				w.add(att.blendEnable, att.srcColorBlendFactor, att.dstColorBlendFactor, att.colorBlendOp,
+					att.srcAlphaBlendFactor, att.dstAlphaBlendFactor, att.alphaBlendOp, static_cast<VkColorComponentFlags>(att.colorWriteMask));
+			}
+			write_multisample_state(w, p.mMultisampleStateCreateInfo);
+			write_dynamic_states(w, p.mDynamicStateEntries);
+
+			libraries.push_back(getOrCreateLibrary(part::fragment_output_interface, std::move(w), vk::GraphicsPipelineLibraryFlagBitsEXT::eFragmentOutputInterface, vk::GraphicsPipelineCreateInfo{}
+				.setPColorBlendState(&p.mColorBlendStateCreateInfo)
+				.setPMultisampleState(&p.mMultisampleStateCreateInfo)
+				.setPDynamicState(dynamicState)
+				.setRenderPass(p.mRenderPass->handle())
+				.setSubpass(p.mSubpassIndex)
+			));
+		}
+
+		// 5. Fast-link the libraries into the final pipeline (i.e., without link time optimization):
+		auto linkInfo = vk::PipelineLibraryCreateInfoKHR{}
+			.setLibraryCount(static_cast<uint32_t>(libraries.size()))
+			.setPLibraries(libraries.data());
+		auto pipelineInfo = vk::GraphicsPipelineCreateInfo{}
+			.setPNext(&linkInfo)
+			.setFlags(p.mPipelineCreateFlags)
+			.setLayout(p.layout_handle())
+			.setBasePipelineHandle(nullptr)
+			.setBasePipelineIndex(-1);
+		std::optional<driver_feedback_request> driverFeedback;
+		if (pipeline_creation_statistics::is_driver_feedback_enabled()) {
+			driverFeedback.emplace(0u); // No stages are passed to the link
+			linkInfo.setPNext(&driverFeedback->mCreateInfo);
+		}
+		auto result = device().createGraphicsPipelineUnique(nullptr, pipelineInfo, nullptr, dispatch_loader_core());
+		aPreparedPipeline.mPipeline = std::move(result.value);
+		if (driverFeedback.has_value()) {
+			apply_driver_feedback(aPreparedPipeline.mCreationFeedback, driverFeedback.value(), {});
+		}
+
+		// 6. Maybe create a link time optimized version in the background:
+		if (aCache.mBackgroundOptimization && !has_flag(p.mPipelineCreateFlags, vk::PipelineCreateFlagBits::eDisableOptimization)) {
+			aPreparedPipeline.mOptimizedPipelineJob = std::async(std::launch::async,
+				[device = device(), dispatchLoader = &dispatch_loader_core(), libraries = std::move(libraries), layout = p.layout_handle(), flags = p.mPipelineCreateFlags]() {
+					auto linkInfo = vk::PipelineLibraryCreateInfoKHR{}
+						.setLibraryCount(static_cast<uint32_t>(libraries.size()))
+						.setPLibraries(libraries.data());
+					auto pipelineInfo = vk::GraphicsPipelineCreateInfo{}
+						.setPNext(&linkInfo)
+						.setFlags(flags | vk::PipelineCreateFlagBits::eLinkTimeOptimizationEXT)
+						.setLayout(layout)
+						.setBasePipelineHandle(nullptr)
+						.setBasePipelineIndex(-1);
+					try {
+						auto result = device.createGraphicsPipelineUnique(nullptr, pipelineInfo, nullptr, *dispatchLoader);
+						return std::move(result.value);
+					}
+					catch (vk::SystemError& e) {
+						AVK_LOG_WARNING(std::string("Creating the link time optimized pipeline failed: ") + e.what());
+						return vk::UniqueHandle<vk::Pipeline, DISPATCH_LOADER_CORE_TYPE>{};
+					}
+				}
+			);
+		}
+	}
+
+	graphics_pipeline_library_cache root::create_graphics_pipeline_library_cache()
+	{
+		graphics_pipeline_library_cache result;
+		result.mRoot = this;
+		return result;
+	}
+
+	size_t graphics_pipeline_library_cache::key_for(part aPart, std::string_view aSubConfig)
+	{
+		size_t key = 0;
+		hash_combine(key, aPart, std::hash<std::string_view>{}(aSubConfig));
+		return key;
+	}
+
+	const graphics_pipeline_library_cache::library* graphics_pipeline_library_cache::find(part aPart, std::string_view aSubConfig) const
+	{
+		// Different sub-configs might have the same key => compare them:
+		const auto [first, last] = mLibraries.equal_range(key_for(aPart, aSubConfig));
+		for (auto it = first; it != last; ++it) {
+			if (it->second.mPart == aPart && it->second.mSubConfig == aSubConfig) {
+				return &it->second;
+			}
+		}
+		return nullptr;
+	}
+
+	void graphics_pipeline_library_cache::cleanup()
+	{
+		mLibraries.clear();
+		mCacheHits = 0;
+		mCacheMisses = 0;
+	}
+#endif
+#pragma endregion
+
+#pragma region pipeline variants definitions
+	namespace
+	{
+		// Invokes aCreateVariant for every permutation of the axes' values, distributed across up to aMaxThreads threads.
+		// The key of a permutation is formed from its value indices with the last axis varying fastest.
+		template <typename P>
+		std::vector<P> create_permutations(const std::vector<size_t>& aAxisSizes, uint32_t aMaxThreads, const std::function<P(const std::vector<size_t>&)>& aCreateVariant)
+		{
+			size_t count = 1;
+			for (auto size : aAxisSizes) {
+				count *= size;
+			}
+
+			std::vector<std::optional<P>> variants(count);
+			std::atomic<size_t> nextKey{ 0 };
+			auto worker = [&]() {
+				std::vector<size_t> valueIndices(aAxisSizes.size());
+				try {
+					for (size_t key = nextKey++; key < count; key = nextKey++) {
+						auto rest = key;
+						for (size_t i = aAxisSizes.size(); i-- > 0;) {
+							valueIndices[i] = rest % aAxisSizes[i];
+							rest /= aAxisSizes[i];
+						}
+						variants[key] = aCreateVariant(valueIndices);
+					}
+				}
+				catch (...) {
+					// Let the other workers stop early:
+					nextKey = count;
+					throw;
+				}
+			};
+
+			const auto numThreads = std::min(count, static_cast<size_t>(0 == aMaxThreads ? std::max(1u, std::thread::hardware_concurrency()) : aMaxThreads));
+			std::vector<std::future<void>> jobs;
+			for (size_t i = 1; i < numThreads; ++i) {
+				jobs.push_back(std::async(std::launch::async, worker));
+			}
+			std::exception_ptr error;
+			try {
+				worker();
+			}
+			catch (...) {
+				error = std::current_exception();
+			}
+			for (auto& job : jobs) {
+				try {
+					job.get();
+				}
+				catch (...) {
+					if (!error) {
+						error = std::current_exception();
+					}
+				}
+			}
+			if (error) {
+				std::rethrow_exception(error);
+			}
+
+			std::vector<P> result;
+			result.reserve(count);
+			for (auto& variant : variants) {
+				result.push_back(std::move(variant.value()));
+			}
+			return result;
+		}
+
+		// Strides of the mixed radix keys, last axis varying fastest
+		std::vector<size_t> strides_for_axis_sizes(const std::vector<size_t>& aAxisSizes)
+		{
+			std::vector<size_t> strides(aAxisSizes.size());
+			size_t stride = 1;
+			for (size_t i = aAxisSizes.size(); i-- > 0;) {
+				strides[i] = stride;
+				stride *= aAxisSizes[i];
+			}
+			return strides;
+		}
+
+		std::vector<size_t> axis_sizes_for(const std::vector<specialization_constant_axis>& aAxes)
+		{
+			std::vector<size_t> sizes;
+			sizes.reserve(aAxes.size());
+			for (const auto& axis : aAxes) {
+				if (0 == axis.num_values()) {
+					throw avk::runtime_error("Specialization constant axis for constant ID " + std::to_string(axis.mConstantId) + " does not contain any values.");
+				}
+				sizes.push_back(axis.num_values());
+			}
+			return sizes;
+		}
+	}
+
+	void root::apply_specialization_constant_permutation(shader& aShader, const std::vector<specialization_constant_axis>& aAxes, const std::vector<size_t>& aValueIndices)
+	{
+		assert(aAxes.size() == aValueIndices.size());
+		for (size_t i = 0; i < aAxes.size(); ++i) {
+			if (shader_type{} == (aAxes[i].mShaderTypes & aShader.mInfo.mShaderType)) {
+				continue;
+			}
+			if (!aShader.mInfo.mSpecializationConstants.has_value()) {
+				aShader.mInfo.mSpecializationConstants = specialization_constants{};
+			}
+			aShader.mInfo.mSpecializationConstants->set(aAxes[i].mConstantId, aAxes[i].value_at(aValueIndices[i]), aAxes[i].mValueSize, aAxes[i].mValueAlignment);
+		}
+	}
+
+	pipeline_variants<graphics_pipeline> root::create_graphics_pipeline_variants(resource_reference<const graphics_pipeline_t> aBasePipeline, std::vector<specialization_constant_axis> aAxes, uint32_t aMaxThreads)
+	{
+#if VK_HEADER_VERSION >= 213
+		if (nullptr != aBasePipeline->mPipelineLibraryCache) {
+			aMaxThreads = 1; // graphics_pipeline_library_cache is not thread-safe
+		}
+#endif
+
+		pipeline_variants<graphics_pipeline> result;
+		result.mAxisSizes = axis_sizes_for(aAxes);
+		result.mStrides = strides_for_axis_sizes(result.mAxisSizes);
+		result.mVariants = create_permutations<graphics_pipeline>(result.mAxisSizes, aMaxThreads, [this, &aBasePipeline, &aAxes](const std::vector<size_t>& aValueIndices) {
+			return create_graphics_pipeline_from_template(aBasePipeline, [&aAxes, &aValueIndices](graphics_pipeline_t& aPipeline) {
+				for (size_t i = 0; i < aPipeline.mShaders.size(); ++i) {
+					apply_specialization_constant_permutation(aPipeline.mShaders[i], aAxes, aValueIndices);
+					const auto& specConsts = aPipeline.mShaders[i].info().mSpecializationConstants;
+					if (specConsts.has_value()) {
+						// The pointers are set when the pipeline is being rewired:
+						aPipeline.mSpecializationInfos[i] = vk::SpecializationInfo{ specConsts->num_entries(), nullptr, specConsts->data_size(), nullptr };
+					}
+				}
+			});
+		});
+		return result;
+	}
+
+	pipeline_variants<compute_pipeline> root::create_compute_pipeline_variants(resource_reference<const compute_pipeline_t> aBasePipeline, std::vector<specialization_constant_axis> aAxes, uint32_t aMaxThreads)
+	{
+		pipeline_variants<compute_pipeline> result;
+		result.mAxisSizes = axis_sizes_for(aAxes);
+		result.mStrides = strides_for_axis_sizes(result.mAxisSizes);
+		result.mVariants = create_permutations<compute_pipeline>(result.mAxisSizes, aMaxThreads, [this, &aBasePipeline, &aAxes](const std::vector<size_t>& aValueIndices) {
+			return create_compute_pipeline_from_template(aBasePipeline, [&aAxes, &aValueIndices](compute_pipeline_t& aPipeline) {
+				apply_specialization_constant_permutation(aPipeline.mShader, aAxes, aValueIndices);
+				const auto& specConsts = aPipeline.mShader.info().mSpecializationConstants;
+				if (specConsts.has_value()) {
+					// The pointers are set when the pipeline is being rewired:
+					aPipeline.mSpecializationInfo = vk::SpecializationInfo{ specConsts->num_entries(), nullptr, specConsts->data_size(), nullptr };
+				}
+			});
+		});
+		return result;
+	}
+#pragma endregion
+
+#pragma region image definitions
+	image_t::image_t(const image_t& aOther)
+	{
+		if (std::holds_alternative<vk::Image>(aOther.mImage)) {
+			mCreateInfo = aOther.mCreateInfo;
+			mImage = std::get<vk::Image>(aOther.mImage);
+			mTargetLayout = aOther.mTargetLayout;
+			mCurrentLayout = aOther.mCurrentLayout;
+			mImageUsage = aOther.mImageUsage;
+			mAspectFlags = aOther.mAspectFlags;
+		}
+		else {
+			throw avk::runtime_error("Can not copy this image instance!");
+		}
+	}
+
+	image root::create_image_from_template(resource_reference<const image_t> aTemplate, std::function<void(image_t&)> aAlterConfigBeforeCreation)
 	{
 		image_t result;
 		result.mCreateInfo = aTemplate->mCreateInfo;
@@ -5864,6 +8750,26 @@ namespace avk
 		mQueue = aDevice.getQueue(mQueueFamilyIndex, mQueueIndex);
 	}
 
+	fence_pool& queue::get_fence_pool() const
+	{
+		if (!mFencePool) {
+			assert(mDevice);
+			mFencePool = std::make_shared<fence_pool>(mDevice, *mDispatchLoader);
+		}
+		return *mFencePool;
+	}
+
+	void queue::release_sync_objects()
+	{
+		if (mFencePool && mFencePool.use_count() > 1) {
+			AVK_LOG_WARNING("Fences of queue[" + std::to_string(mQueueFamilyIndex) + "," + std::to_string(mQueueIndex) + "]'s fence_pool are still alive. They keep the pool alive, and must be destroyed before the device.");
+		}
+		mFencePool.reset();
+#if VK_HEADER_VERSION >= 135
+		mTimelineSemaphore.reset();
+#endif
+	}
+
 
 
 
@@ -5990,7 +8896,7 @@ namespace avk
 	{
 		assert(aCommandBuffer->state() >= command_buffer_state::finished_recording);
 
-		auto fen = root::create_fence(mDevice, *mDispatchLoader);
+		auto fen = get_fence_pool().acquire();
 
 		if (0 == aWaitSemaphores.size()) {
 			// Optimized route for 0 _WaitSemaphores
@@ -6057,7 +8963,7 @@ namespace avk
 			handles.push_back(cb->handle());
 		}
 
-		auto fen = root::create_fence(mDevice, *mDispatchLoader);
+		auto fen = get_fence_pool().acquire();
 
 		if (aWaitSemaphores.empty()) {
 			// Optimized route for 0 _WaitSemaphores
@@ -6105,177 +9011,975 @@ namespace avk
 				cb.get().mState = command_buffer_state::submitted;
 			}
 
-			// TODO: Use ranges
-			std::vector<semaphore> ownedSemaphores;
-			for (auto& e : aWaitSemaphores) {
-				ownedSemaphores.push_back(e.own());
+			// TODO: Use ranges
+			std::vector<semaphore> ownedSemaphores;
+			for (auto& e : aWaitSemaphores) {
+				ownedSemaphores.push_back(e.own());
+			}
+
+			fen->set_custom_deleter([
+				lOwnedWaitSemaphores{ std::move(ownedSemaphores) }
+			](){});
+		}
+
+		return fen;
+	}
+
+	semaphore queue::submit_and_handle_with_semaphore(resource_ownership<command_buffer_t> aCommandBuffer, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores)
+	{
+		assert(aCommandBuffer->state() >= command_buffer_state::finished_recording);
+
+		// Create a semaphore which can, or rather, MUST be used to wait for the results
+		auto signalWhenCompleteSemaphore = root::create_semaphore(mDevice, *mDispatchLoader);
+
+		if (aWaitSemaphores.empty()) {
+			// Optimized route for 0 _WaitSemaphores
+			const auto submitInfo = vk::SubmitInfo{}
+				.setCommandBufferCount(1u)
+				.setPCommandBuffers(aCommandBuffer->handle_ptr())
+				.setWaitSemaphoreCount(0u)
+				.setPWaitSemaphores(nullptr)
+				.setPWaitDstStageMask(nullptr)
+				.setSignalSemaphoreCount(1u)
+				.setPSignalSemaphores(signalWhenCompleteSemaphore->handle_addr());
+
+			handle().submit({ submitInfo }, nullptr);
+			aCommandBuffer->invoke_post_execution_handler();
+
+			aCommandBuffer->mState = command_buffer_state::submitted;
+
+			signalWhenCompleteSemaphore->set_custom_deleter([
+				lOwnedCommandBuffer{ std::move(aCommandBuffer) } // Take care of the command_buffer's lifetime.. OMG!
+			](){});
+		}
+		else {
+			// Also set the wait semaphores and take care of their lifetimes
+			std::vector<vk::Semaphore> waitSemaphoreHandles;
+			waitSemaphoreHandles.reserve(aWaitSemaphores.size());
+			std::vector<vk::PipelineStageFlags> waitDstStageMasks;
+			waitDstStageMasks.reserve(aWaitSemaphores.size());
+
+			for (const auto& semaphoreDependency : aWaitSemaphores) {
+				waitSemaphoreHandles.push_back(semaphoreDependency->handle());
+				waitDstStageMasks.push_back(semaphoreDependency->semaphore_wait_stage());
+			}
+
+			const auto submitInfo = vk::SubmitInfo{}
+				.setCommandBufferCount(1u)
+				.setPCommandBuffers(aCommandBuffer->handle_ptr())
+				.setWaitSemaphoreCount(static_cast<uint32_t>(waitSemaphoreHandles.size()))
+				.setPWaitSemaphores(waitSemaphoreHandles.data())
+				.setPWaitDstStageMask(waitDstStageMasks.data())
+				.setSignalSemaphoreCount(1u)
+				.setPSignalSemaphores(signalWhenCompleteSemaphore->handle_addr());
+
+			handle().submit({ submitInfo }, nullptr);
+			aCommandBuffer->invoke_post_execution_handler();
+
+			aCommandBuffer->mState = command_buffer_state::submitted;
+
+			// TODO: Use ranges
+			std::vector<semaphore> ownedSemaphores;
+			for (auto& e : aWaitSemaphores) {
+				ownedSemaphores.push_back(e.own());
+			}
+
+			signalWhenCompleteSemaphore->set_custom_deleter([
+				lOwnedWaitSemaphores{ std::move(ownedSemaphores) },
+				lOwnedCommandBuffer{ aCommandBuffer.own() } // Take care of the command_buffer's lifetime.. OMG!
+			](){});
+		}
+
+		return signalWhenCompleteSemaphore;
+	}
+
+	semaphore queue::submit_and_handle_with_semaphore(std::optional<resource_ownership<command_buffer_t>> aCommandBuffer, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores)
+	{
+		if (!aCommandBuffer.has_value()) {
+			throw avk::runtime_error("std::optional<command_buffer> submitted and it has no value.");
+		}
+		return submit_and_handle_with_semaphore(std::move(aCommandBuffer.value()), std::move(aWaitSemaphores));
+	}
+
+	// The code between these two ^ and v is mostly copied... I know. It avoids the usage of an unneccessary
+	// temporary vector in single command buffer-case. Should, however, probably be refactored.
+	semaphore queue::submit_and_handle_with_semaphore(std::vector<resource_ownership<command_buffer_t>> aCommandBuffers, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores)
+	{
+		std::vector<vk::CommandBuffer> handles;
+		handles.reserve(aCommandBuffers.size());
+		for (auto& cb : aCommandBuffers) {
+			assert(cb->state() >= command_buffer_state::finished_recording);
+			handles.push_back(cb->handle());
+		}
+
+		// Create a semaphore which can, or rather, MUST be used to wait for the results
+		auto signalWhenCompleteSemaphore = root::create_semaphore(mDevice, *mDispatchLoader);
+
+		if (aWaitSemaphores.empty()) {
+			// Optimized route for 0 _WaitSemaphores
+			const auto submitInfo = vk::SubmitInfo{}
+				.setCommandBufferCount(static_cast<uint32_t>(handles.size()))
+				.setPCommandBuffers(handles.data())
+				.setWaitSemaphoreCount(0u)
+				.setPWaitSemaphores(nullptr)
+				.setPWaitDstStageMask(nullptr)
+				.setSignalSemaphoreCount(1u)
+				.setPSignalSemaphores(signalWhenCompleteSemaphore->handle_addr());
+
+			handle().submit({ submitInfo }, nullptr);
+			for (auto& cb : aCommandBuffers) {
+				cb->invoke_post_execution_handler();
+
+				cb->mState = command_buffer_state::submitted;
+			}
+
+			signalWhenCompleteSemaphore->set_custom_deleter([
+				lOwnedCommandBuffer{ std::move(aCommandBuffers) } // Take care of the command_buffer's lifetime.. OMG!
+			](){});
+		}
+		else {
+			// Also set the wait semaphores and take care of their lifetimes
+			std::vector<vk::Semaphore> waitSemaphoreHandles;
+			waitSemaphoreHandles.reserve(aWaitSemaphores.size());
+			std::vector<vk::PipelineStageFlags> waitDstStageMasks;
+			waitDstStageMasks.reserve(aWaitSemaphores.size());
+
+			for (const auto& semaphoreDependency : aWaitSemaphores) {
+				waitSemaphoreHandles.push_back(semaphoreDependency->handle());
+				waitDstStageMasks.push_back(semaphoreDependency->semaphore_wait_stage());
+			}
+
+			const auto submitInfo = vk::SubmitInfo{}
+				.setCommandBufferCount(static_cast<uint32_t>(handles.size()))
+				.setPCommandBuffers(handles.data())
+				.setWaitSemaphoreCount(static_cast<uint32_t>(waitSemaphoreHandles.size()))
+				.setPWaitSemaphores(waitSemaphoreHandles.data())
+				.setPWaitDstStageMask(waitDstStageMasks.data())
+				.setSignalSemaphoreCount(1u)
+				.setPSignalSemaphores(signalWhenCompleteSemaphore->handle_addr());
+
+			handle().submit({ submitInfo }, nullptr);
+			for (auto& cb : aCommandBuffers) {
+				cb->invoke_post_execution_handler();
+
+				cb->mState = command_buffer_state::submitted;
+			}
+
+			// TODO: Use ranges
+			std::vector<command_buffer> ownedCommandBuffers;
+			for (auto& e : aCommandBuffers) {
+				ownedCommandBuffers.push_back(e.own());
+			}
+			std::vector<semaphore> ownedSemaphores;
+			for (auto& e : aWaitSemaphores) {
+				ownedSemaphores.push_back(e.own());
+			}
+
+			signalWhenCompleteSemaphore->set_custom_deleter([
+				lOwnedWaitSemaphores{ std::move(ownedSemaphores) },
+				lOwnedCommandBuffer{ std::move(aCommandBuffers) } // Take care of the command_buffer's lifetime.. OMG!
+			](){});
+		}
+
+		return signalWhenCompleteSemaphore;
+	}
+
+#if VK_HEADER_VERSION >= 135
+	completion_token queue::submit_with_completion_token(std::vector<resource_reference<command_buffer_t>> aCommandBuffers, std::vector<completion_token> aWaitFor, vk::PipelineStageFlags aWaitStage, completion_dispatcher* aCompletionDispatcher)
+	{
+		std::vector<vk::CommandBuffer> handles;
+		handles.reserve(aCommandBuffers.size());
+		for (auto& cb : aCommandBuffers) {
+			assert(cb->state() >= command_buffer_state::finished_recording);
+			handles.push_back(cb->handle());
+		}
+
+		std::vector<vk::Semaphore> waitSemaphores;
+		std::vector<uint64_t> waitValues;
+		gather_timeline_waits(aWaitFor, waitSemaphores, waitValues);
+		const std::vector<vk::PipelineStageFlags> waitStages(waitSemaphores.size(), aWaitStage);
+
+		const auto signalSemaphore = get_or_create_timeline_semaphore();
+		const auto signalValue = mTimelineValue + 1;
+
+		const auto timelineSubmitInfo = vk::TimelineSemaphoreSubmitInfo{}
+			.setWaitSemaphoreValueCount(static_cast<uint32_t>(waitValues.size()))
+			.setPWaitSemaphoreValues(waitValues.data())
+			.setSignalSemaphoreValueCount(1u)
+			.setPSignalSemaphoreValues(&signalValue);
+		const auto submitInfo = vk::SubmitInfo{}
+			.setPNext(&timelineSubmitInfo)
+			.setCommandBufferCount(static_cast<uint32_t>(handles.size()))
+			.setPCommandBuffers(handles.data())
+			.setWaitSemaphoreCount(static_cast<uint32_t>(waitSemaphores.size()))
+			.setPWaitSemaphores(waitSemaphores.data())
+			.setPWaitDstStageMask(waitStages.data())
+			.setSignalSemaphoreCount(1u)
+			.setPSignalSemaphores(&signalSemaphore);
+
+		handle().submit({ submitInfo }, nullptr);
+		mTimelineValue = signalValue;
+		for (auto& cb : aCommandBuffers) {
+			cb.get().invoke_post_execution_handler();
+
+			cb.get().mState = command_buffer_state::submitted;
+		}
+
+		const auto token = completion_token{ this, signalValue };
+		if (nullptr != aCompletionDispatcher) {
+			for (auto& cb : aCommandBuffers) {
+				cb.get().hand_over_completion_handlers(*aCompletionDispatcher, token);
+			}
+		}
+		return token;
+	}
+
+	void queue::gather_timeline_waits(const std::vector<completion_token>& aTokens, std::vector<vk::Semaphore>& aSemaphores, std::vector<uint64_t>& aValues)
+	{
+		// Waiting for the highest value of each queue's timeline semaphore covers all lower ones:
+		const auto firstGathered = aSemaphores.size();
+		for (const auto& token : aTokens) {
+			if (nullptr == token.mQueue || 0 == token.mValue) {
+				continue; // Refers to no work
+			}
+			const auto sema = token.mQueue->timeline_semaphore();
+			const auto it = std::find(std::begin(aSemaphores) + firstGathered, std::end(aSemaphores), sema);
+			if (std::end(aSemaphores) == it) {
+				aSemaphores.push_back(sema);
+				aValues.push_back(token.mValue);
+			}
+			else {
+				auto& value = aValues[std::distance(std::begin(aSemaphores), it)];
+				value = std::max(value, token.mValue);
+			}
+		}
+	}
+
+	vk::Semaphore queue::get_or_create_timeline_semaphore()
+	{
+		if (!mTimelineSemaphore) {
+			auto typeCreateInfo = vk::SemaphoreTypeCreateInfo{}
+				.setSemaphoreType(vk::SemaphoreType::eTimeline)
+				.setInitialValue(mTimelineValue);
+			mTimelineSemaphore = mDevice.createSemaphoreUnique(vk::SemaphoreCreateInfo{}.setPNext(&typeCreateInfo), nullptr, *mDispatchLoader);
+		}
+		return mTimelineSemaphore.get();
+	}
+
+	uint64_t queue::completed_value() const
+	{
+		if (!mTimelineSemaphore) {
+			return mTimelineValue;
+		}
+		return mDevice.getSemaphoreCounterValue(mTimelineSemaphore.get(), *mDispatchLoader);
+	}
+#endif
+#pragma endregion
+
+#if VK_HEADER_VERSION >= 135
+#pragma region completion token definitions
+	bool completion_token::wait_for(const std::vector<completion_token>& aTokens, vk::SemaphoreWaitFlags aFlags, std::optional<uint64_t> aTimeout)
+	{
+		const bool any = static_cast<bool>(vk::SemaphoreWaitFlagBits::eAny & aFlags);
+		const queue* anyQueue = nullptr;
+		std::vector<vk::Semaphore> semaphores;
+		std::vector<uint64_t> values;
+		for (const auto& token : aTokens) {
+			if (nullptr == token.mQueue || 0 == token.mValue) {
+				if (any) {
+					return true; // Refers to no work, hence it has completed already
+				}
+				continue;
+			}
+			anyQueue = token.mQueue;
+			const auto sema = token.mQueue->timeline_semaphore();
+			const auto it = std::find(std::begin(semaphores), std::end(semaphores), sema);
+			if (std::end(semaphores) == it) {
+				semaphores.push_back(sema);
+				values.push_back(token.mValue);
+			}
+			else {
+				// All of them: the highest value matters; any of them: the lowest one.
+				auto& value = values[std::distance(std::begin(semaphores), it)];
+				value = any ? std::min(value, token.mValue) : std::max(value, token.mValue);
+			}
+		}
+		if (semaphores.empty()) {
+			return true;
+		}
+
+		const auto waitInfo = vk::SemaphoreWaitInfo{}
+			.setFlags(aFlags)
+			.setSemaphoreCount(static_cast<uint32_t>(semaphores.size()))
+			.setPSemaphores(semaphores.data())
+			.setPValues(values.data());
+		const auto result = anyQueue->mDevice.waitSemaphores(waitInfo, aTimeout.value_or(UINT64_MAX), *anyQueue->mDispatchLoader);
+		return vk::Result::eSuccess == result;
+	}
+
+	bool completion_token::is_complete() const
+	{
+		return nullptr == mQueue || mQueue->completed_value() >= mValue;
+	}
+
+	bool completion_token::wait(std::optional<uint64_t> aTimeout) const
+	{
+		return wait_for({ *this }, vk::SemaphoreWaitFlags{}, aTimeout);
+	}
+
+	bool completion_token::wait_for_all(const std::vector<completion_token>& aTokens, std::optional<uint64_t> aTimeout)
+	{
+		return wait_for(aTokens, vk::SemaphoreWaitFlags{}, aTimeout);
+	}
+
+	bool completion_token::wait_for_any(const std::vector<completion_token>& aTokens, std::optional<uint64_t> aTimeout)
+	{
+		return aTokens.empty() || wait_for(aTokens, vk::SemaphoreWaitFlagBits::eAny, aTimeout);
+	}
+#pragma endregion
+#endif
+
+#pragma region deletion queue definitions
+	deletion_queue::deletion_queue()
+		: mMutex{ std::make_unique<std::mutex>() }
+	{
+	}
+
+	void deletion_queue::add_fence_bucket(fence aFence, std::vector<std::unique_ptr<erased_resource>> aResources)
+	{
+		std::scoped_lock guard(*mMutex);
+		mNumberOfResources += aResources.size();
+		mFenceBuckets.push_back(fence_bucket{ std::move(aFence), std::move(aResources) });
+	}
+
+#if VK_HEADER_VERSION >= 135
+	void deletion_queue::add_to_token_bucket(const completion_token& aToken, std::vector<std::unique_ptr<erased_resource>> aResources)
+	{
+		std::scoped_lock guard(*mMutex);
+		mNumberOfResources += aResources.size();
+		// Resources of one submission are usually added one after the other => look for the bucket from the back:
+		for (auto it = mTokenBuckets.rbegin(); it != mTokenBuckets.rend(); ++it) {
+			if (it->mToken == aToken) {
+				std::move(std::begin(aResources), std::end(aResources), std::back_inserter(it->mResources));
+				return;
+			}
+		}
+		mTokenBuckets.push_back(token_bucket{ aToken, std::move(aResources) });
+	}
+#endif
+
+	size_t deletion_queue::collect()
+	{
+		if (!mMutex) {
+			return 0;
+		}
+		// Declared before the resources, s.t. the fences are destroyed after them:
+		std::vector<fence> completedFences;
+		std::vector<std::unique_ptr<erased_resource>> completedResources;
+		{
+			std::scoped_lock guard(*mMutex);
+			for (auto it = std::begin(mFenceBuckets); it != std::end(mFenceBuckets);) {
+				if (it->mFence->is_signalled()) {
+					std::move(std::begin(it->mResources), std::end(it->mResources), std::back_inserter(completedResources));
+					completedFences.push_back(std::move(it->mFence));
+					it = mFenceBuckets.erase(it);
+				}
+				else {
+					++it;
+				}
+			}
+#if VK_HEADER_VERSION >= 135
+			// Query each queue's timeline semaphore only once:
+			std::vector<std::tuple<const queue*, uint64_t>> completedValues;
+			for (auto it = std::begin(mTokenBuckets); it != std::end(mTokenBuckets);) {
+				const auto* q = it->mToken.mQueue;
+				auto cv = std::find_if(std::begin(completedValues), std::end(completedValues), [q](const auto& aEntry) { return std::get<const queue*>(aEntry) == q; });
+				if (std::end(completedValues) == cv) {
+					completedValues.emplace_back(q, nullptr == q ? 0 : q->completed_value());
+					cv = std::prev(std::end(completedValues));
+				}
+				if (it->mToken.mValue <= std::get<uint64_t>(*cv)) {
+					std::move(std::begin(it->mResources), std::end(it->mResources), std::back_inserter(completedResources));
+					it = mTokenBuckets.erase(it);
+				}
+				else {
+					++it;
+				}
+			}
+#endif
+			mNumberOfResources -= completedResources.size();
+		}
+		// Destroy them outside of the lock, since their destructors might add further resources:
+		const auto count = completedResources.size();
+		completedResources.clear();
+		return count;
+	}
+
+	size_t deletion_queue::size() const
+	{
+		if (!mMutex) {
+			return 0;
+		}
+		std::scoped_lock guard(*mMutex);
+		return mNumberOfResources;
+	}
+#pragma endregion
+
+#pragma region completion dispatcher definitions
+	completion_dispatcher::~completion_dispatcher()
+	{
+		stop_background_thread();
+	}
+
+#if VK_HEADER_VERSION >= 135
+	void completion_dispatcher::on_completion(const completion_token& aToken, avk::unique_function<void()> aCallback)
+	{
+		{
+			std::scoped_lock guard(mMutex);
+			auto& e = mEntries.emplace_back();
+			e.mToken = aToken;
+			e.mCallback = std::move(aCallback);
+		}
+		mWorkAdded.notify_all();
+	}
+#endif
+
+	void completion_dispatcher::on_completion(fence aFence, avk::unique_function<void()> aCallback)
+	{
+		{
+			std::scoped_lock guard(mMutex);
+			auto& e = mEntries.emplace_back();
+			e.mFence = std::move(aFence);
+			e.mCallback = std::move(aCallback);
+		}
+		mWorkAdded.notify_all();
+	}
+
+	bool completion_dispatcher::is_complete(const entry& aEntry)
+	{
+#if VK_HEADER_VERSION >= 135
+		if (aEntry.mToken.has_value()) {
+			return aEntry.mToken->is_complete();
+		}
+#endif
+		return !aEntry.mFence.has_value() || aEntry.mFence.value()->is_signalled();
+	}
+
+	size_t completion_dispatcher::poll()
+	{
+		// Declared before the callbacks, s.t. the fences are destroyed after them:
+		std::vector<fence> completedFences;
+		std::vector<avk::unique_function<void()>> callbacks;
+		{
+			std::scoped_lock guard(mMutex);
+			// While the background thread is running, it is the one which checks pending work:
+			const bool checkPendingWork = !mBackgroundThreadRunning;
+			for (auto it = std::begin(mEntries); it != std::end(mEntries);) {
+				if (it->mCompleted || (checkPendingWork && is_complete(*it))) {
+					callbacks.push_back(std::move(it->mCallback));
+					if (it->mFence.has_value()) {
+						completedFences.push_back(std::move(it->mFence.value()));
+					}
+					it = mEntries.erase(it);
+				}
+				else {
+					++it;
+				}
+			}
+		}
+		// Invoke them outside of the lock, since they might register further callbacks:
+		for (auto& callback : callbacks) {
+			if (callback) {
+				callback();
+			}
+		}
+		return callbacks.size();
+	}
+
+	void completion_dispatcher::start_background_thread(bool aInvokeCallbacksOnBackgroundThread, std::chrono::microseconds aMaxWaitTime)
+	{
+		std::scoped_lock guard(mMutex);
+		if (mBackgroundThreadRunning) {
+			throw avk::logic_error("The background thread of this completion_dispatcher is already running.");
+		}
+		if (mBackgroundThread.joinable()) {
+			// It has exited after an error:
+			mBackgroundThread.join();
+		}
+		mStopBackgroundThread = false;
+		mBackgroundThreadRunning = true;
+		mBackgroundThread = std::thread(&completion_dispatcher::background_thread_loop, this, aInvokeCallbacksOnBackgroundThread, aMaxWaitTime);
+	}
+
+	void completion_dispatcher::stop_background_thread()
+	{
+		std::thread backgroundThread;
+		bool wasRunning;
+		{
+			std::scoped_lock guard(mMutex);
+			wasRunning = mBackgroundThreadRunning;
+			if (wasRunning) {
+				mStopBackgroundThread = true;
+			}
+			// If it has exited after an error, it only remains to be joined:
+			backgroundThread = std::move(mBackgroundThread);
+		}
+		mWorkAdded.notify_all();
+		if (backgroundThread.joinable()) {
+			backgroundThread.join();
+		}
+		if (wasRunning) {
+			std::scoped_lock guard(mMutex);
+			mBackgroundThreadRunning = false;
+		}
+	}
+
+	size_t completion_dispatcher::number_of_pending_callbacks() const
+	{
+		std::scoped_lock guard(mMutex);
+		return mEntries.size();
+	}
+
+	void completion_dispatcher::background_thread_loop(bool aInvokeCallbacks, std::chrono::microseconds aMaxWaitTime)
+	{
+		const auto timeout = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(aMaxWaitTime).count());
+		std::unique_lock lock(mMutex);
+		while (!mStopBackgroundThread) {
+			// Gather the pending work. Only this thread removes entries which are not marked as completed,
+			// hence the fences stay alive while it waits for them without holding the lock.
+#if VK_HEADER_VERSION >= 135
+			std::vector<completion_token> tokens;
+#endif
+			std::vector<vk::Fence> fenceHandles;
+			vk::Device device;
+			for (const auto& e : mEntries) {
+				if (e.mCompleted) {
+					continue;
+				}
+#if VK_HEADER_VERSION >= 135
+				if (e.mToken.has_value()) {
+					tokens.push_back(e.mToken.value());
+					continue;
+				}
+#endif
+				if (e.mFence.has_value()) {
+					fenceHandles.push_back(e.mFence.value()->handle());
+					device = e.mFence.value()->mFence.getOwner();
+				}
+			}
+			bool nothingToWaitFor = fenceHandles.empty();
+#if VK_HEADER_VERSION >= 135
+			nothingToWaitFor = nothingToWaitFor && tokens.empty();
+#endif
+			if (nothingToWaitFor) {
+				// Spurious wake-ups are fine; the pending work is gathered anew either way:
+				mWorkAdded.wait(lock);
+				continue;
 			}
 
-			fen->set_custom_deleter([
-				lOwnedWaitSemaphores{ std::move(ownedSemaphores) }
-			](){});
+			lock.unlock();
+			try {
+				// Block until some of the work has completed or the timeout has elapsed. If there are tokens,
+				// the fences are only checked afterwards, i.e., they are detected with a delay of aMaxWaitTime at most.
+#if VK_HEADER_VERSION >= 135
+				if (!tokens.empty()) {
+					completion_token::wait_for_any(tokens, timeout);
+				}
+				else
+#endif
+				{
+					[[maybe_unused]] const auto result = device.waitForFences(fenceHandles, VK_FALSE, timeout);
+				}
+			}
+			catch (const std::exception& e) {
+				AVK_LOG_ERROR(std::string("Waiting for pending work in completion_dispatcher's background thread failed: ") + e.what());
+				// Hand the pending work over to poll():
+				lock.lock();
+				mBackgroundThreadRunning = false;
+				return;
+			}
+
+			// Declared before the callbacks, s.t. the fences are destroyed after them:
+			std::vector<fence> completedFences;
+			std::vector<avk::unique_function<void()>> callbacks;
+			lock.lock();
+			for (auto it = std::begin(mEntries); it != std::end(mEntries);) {
+				if (it->mCompleted || !is_complete(*it)) {
+					++it;
+				}
+				else if (aInvokeCallbacks) {
+					callbacks.push_back(std::move(it->mCallback));
+					if (it->mFence.has_value()) {
+						completedFences.push_back(std::move(it->mFence.value()));
+					}
+					it = mEntries.erase(it);
+				}
+				else {
+					// Leave it to poll():
+					it->mCompleted = true;
+					++it;
+				}
+			}
+			if (!callbacks.empty()) {
+				lock.unlock();
+				for (auto& callback : callbacks) {
+					if (callback) {
+						callback();
+					}
+				}
+				callbacks.clear();
+				completedFences.clear();
+				lock.lock();
+			}
 		}
+	}
 
-		return fen;
+#if VK_HEADER_VERSION >= 135
+	void command_buffer_t::hand_over_completion_handlers(completion_dispatcher& aCompletionDispatcher, const completion_token& aToken)
+	{
+		for (auto& handler : mCompletionHandlers) {
+			aCompletionDispatcher.on_completion(aToken, std::move(handler));
+		}
+		mCompletionHandlers.clear();
 	}
+#endif
+#pragma endregion
 
-	semaphore queue::submit_and_handle_with_semaphore(resource_ownership<command_buffer_t> aCommandBuffer, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores)
+#pragma region submission service definitions
+#if VK_HEADER_VERSION >= 135
+	submission_service::submission_service(queue& aQueue, completion_dispatcher& aCompletionDispatcher)
+		: mQueue{ &aQueue }
+		, mCompletionDispatcher{ &aCompletionDispatcher }
+		, mHead{ new node }
 	{
-		assert(aCommandBuffer->state() >= command_buffer_state::finished_recording);
+		mTail = mHead.load(std::memory_order_relaxed);
+		mSubmissionThread = std::thread(&submission_service::submission_thread_loop, this);
+	}
 
-		// Create a semaphore which can, or rather, MUST be used to wait for the results
-		auto signalWhenCompleteSemaphore = root::create_semaphore(mDevice, *mDispatchLoader);
+	submission_service::~submission_service()
+	{
+		// A node without a batch stops the submission thread after it has submitted everything before it:
+		push(nullptr);
+		mSubmissionThread.join();
+		// Only the stub node is left:
+		delete mTail;
+	}
 
-		if (aWaitSemaphores.empty()) {
-			// Optimized route for 0 _WaitSemaphores
-			const auto submitInfo = vk::SubmitInfo{}
-				.setCommandBufferCount(1u)
-				.setPCommandBuffers(aCommandBuffer->handle_ptr())
-				.setWaitSemaphoreCount(0u)
-				.setPWaitSemaphores(nullptr)
-				.setPWaitDstStageMask(nullptr)
-				.setSignalSemaphoreCount(1u)
-				.setPSignalSemaphores(signalWhenCompleteSemaphore->handle_addr());
+	void submission_service::push(std::unique_ptr<pending_batch> aPending)
+	{
+		auto* n = new node;
+		n->mPending = std::move(aPending);
+		// Linearization point: After the exchange, n is the head. Until its predecessor's mNext has been set,
+		// the submission thread sees the queue as ending at the predecessor, and picks n up on its next wake-up.
+		auto* prev = mHead.exchange(n, std::memory_order_acq_rel);
+		prev->mNext.store(n, std::memory_order_release);
+		mNumberOfPushedBatches.fetch_add(1, std::memory_order_release);
+		mNumberOfPushedBatches.notify_one();
+	}
 
-			handle().submit({ submitInfo }, nullptr);
-			aCommandBuffer->invoke_post_execution_handler();
+	bool submission_service::try_pop(std::unique_ptr<pending_batch>& aPending)
+	{
+		auto* next = mTail->mNext.load(std::memory_order_acquire);
+		if (nullptr == next) {
+			return false;
+		}
+		// next becomes the new stub node:
+		aPending = std::move(next->mPending);
+		delete mTail;
+		mTail = next;
+		return true;
+	}
 
-			aCommandBuffer->mState = command_buffer_state::submitted;
+	std::future<completion_token> submission_service::submit(batch aBatch)
+	{
+#if defined(_DEBUG)
+		for (const auto& cb : aBatch.mCommandBuffers) {
+			assert(cb->state() >= command_buffer_state::finished_recording);
+		}
+#endif
+		auto pending = std::make_unique<pending_batch>();
+		pending->mBatch = std::move(aBatch);
+		auto result = pending->mPromise.get_future();
+		push(std::move(pending));
+		return result;
+	}
 
-			signalWhenCompleteSemaphore->set_custom_deleter([
-				lOwnedCommandBuffer{ std::move(aCommandBuffer) } // Take care of the command_buffer's lifetime.. OMG!
-			](){});
+	void submission_service::flush()
+	{
+		const auto target = mNumberOfPushedBatches.load(std::memory_order_acquire);
+		auto submitted = mNumberOfSubmittedBatches.load(std::memory_order_acquire);
+		while (submitted < target) {
+			mNumberOfSubmittedBatches.wait(submitted, std::memory_order_acquire);
+			submitted = mNumberOfSubmittedBatches.load(std::memory_order_acquire);
 		}
-		else {
-			// Also set the wait semaphores and take care of their lifetimes
-			std::vector<vk::Semaphore> waitSemaphoreHandles;
-			waitSemaphoreHandles.reserve(aWaitSemaphores.size());
-			std::vector<vk::PipelineStageFlags> waitDstStageMasks;
-			waitDstStageMasks.reserve(aWaitSemaphores.size());
+	}
 
-			for (const auto& semaphoreDependency : aWaitSemaphores) {
-				waitSemaphoreHandles.push_back(semaphoreDependency->handle());
-				waitDstStageMasks.push_back(semaphoreDependency->semaphore_wait_stage());
+	void submission_service::submission_thread_loop()
+	{
+		bool stop = false;
+		std::vector<std::unique_ptr<pending_batch>> batches;
+		while (!stop) {
+			// Read the counter before draining, s.t. a push which is missed by the drain changes it and ends the wait:
+			const auto pushed = mNumberOfPushedBatches.load(std::memory_order_acquire);
+			std::unique_ptr<pending_batch> pending;
+			while (try_pop(pending)) {
+				if (!pending) {
+					stop = true;
+					break;
+				}
+				batches.push_back(std::move(pending));
 			}
+			if (batches.empty()) {
+				if (!stop) {
+					mNumberOfPushedBatches.wait(pushed, std::memory_order_acquire);
+				}
+				continue;
+			}
+			submit_coalesced(batches);
+			mNumberOfSubmittedBatches.fetch_add(batches.size(), std::memory_order_release);
+			mNumberOfSubmittedBatches.notify_all();
+			batches.clear();
+		}
+	}
 
-			const auto submitInfo = vk::SubmitInfo{}
-				.setCommandBufferCount(1u)
-				.setPCommandBuffers(aCommandBuffer->handle_ptr())
-				.setWaitSemaphoreCount(static_cast<uint32_t>(waitSemaphoreHandles.size()))
-				.setPWaitSemaphores(waitSemaphoreHandles.data())
-				.setPWaitDstStageMask(waitDstStageMasks.data())
-				.setSignalSemaphoreCount(1u)
-				.setPSignalSemaphores(signalWhenCompleteSemaphore->handle_addr());
-
-			handle().submit({ submitInfo }, nullptr);
-			aCommandBuffer->invoke_post_execution_handler();
+	void submission_service::submit_coalesced(std::vector<std::unique_ptr<pending_batch>>& aBatches)
+	{
+		// The arrays which one vk::SubmitInfo points into:
+		struct submit_data
+		{
+			std::vector<vk::CommandBuffer> mCommandBuffers;
+			std::vector<vk::Semaphore> mWaitSemaphores;
+			std::vector<uint64_t> mWaitValues;
+			std::vector<vk::PipelineStageFlags> mWaitStages;
+			std::vector<vk::Semaphore> mSignalSemaphores;
+			std::vector<uint64_t> mSignalValues;
+			vk::TimelineSemaphoreSubmitInfo mTimelineSubmitInfo;
+		};
 
-			aCommandBuffer->mState = command_buffer_state::submitted;
+		auto& q = *mQueue;
+		std::vector<submit_data> data(aBatches.size());
+		std::vector<vk::SubmitInfo> submitInfos;
+		submitInfos.reserve(aBatches.size());
+		try {
+			const auto timelineSemaphore = q.get_or_create_timeline_semaphore();
+			for (size_t i = 0; i < aBatches.size(); ++i) {
+				auto& b = aBatches[i]->mBatch;
+				auto& d = data[i];
+				for (auto& cb : b.mCommandBuffers) {
+					d.mCommandBuffers.push_back(cb->handle());
+				}
+				// Binary semaphores come first; their values are ignored:
+				for (const auto& [sema, stage] : b.mWaitSemaphores) {
+					d.mWaitSemaphores.push_back(sema);
+					d.mWaitValues.push_back(0);
+					d.mWaitStages.push_back(stage);
+				}
+				queue::gather_timeline_waits(b.mWaitFor, d.mWaitSemaphores, d.mWaitValues);
+				d.mWaitStages.resize(d.mWaitSemaphores.size(), b.mWaitStage);
+				for (auto sema : b.mSignalSemaphores) {
+					d.mSignalSemaphores.push_back(sema);
+					d.mSignalValues.push_back(0);
+				}
+				// Batches signal consecutive values in the order in which they are submitted:
+				d.mSignalSemaphores.push_back(timelineSemaphore);
+				d.mSignalValues.push_back(q.mTimelineValue + 1 + i);
+
+				d.mTimelineSubmitInfo
+					.setWaitSemaphoreValueCount(static_cast<uint32_t>(d.mWaitValues.size()))
+					.setPWaitSemaphoreValues(d.mWaitValues.data())
+					.setSignalSemaphoreValueCount(static_cast<uint32_t>(d.mSignalValues.size()))
+					.setPSignalSemaphoreValues(d.mSignalValues.data());
+				submitInfos.push_back(vk::SubmitInfo{}
+					.setPNext(&d.mTimelineSubmitInfo)
+					.setCommandBufferCount(static_cast<uint32_t>(d.mCommandBuffers.size()))
+					.setPCommandBuffers(d.mCommandBuffers.data())
+					.setWaitSemaphoreCount(static_cast<uint32_t>(d.mWaitSemaphores.size()))
+					.setPWaitSemaphores(d.mWaitSemaphores.data())
+					.setPWaitDstStageMask(d.mWaitStages.data())
+					.setSignalSemaphoreCount(static_cast<uint32_t>(d.mSignalSemaphores.size()))
+					.setPSignalSemaphores(d.mSignalSemaphores.data())
+				);
+			}
 
-			// TODO: Use ranges
-			std::vector<semaphore> ownedSemaphores;
-			for (auto& e : aWaitSemaphores) {
-				ownedSemaphores.push_back(e.own());
+			q.handle().submit(submitInfos, nullptr);
+			mNumberOfSubmitCalls.fetch_add(1, std::memory_order_release);
+		}
+		catch (...) {
+			// Nothing has been submitted. The command buffers are destroyed together with the batches.
+			for (auto& pending : aBatches) {
+				pending->mPromise.set_exception(std::current_exception());
 			}
+			return;
+		}
 
-			signalWhenCompleteSemaphore->set_custom_deleter([
-				lOwnedWaitSemaphores{ std::move(ownedSemaphores) },
-				lOwnedCommandBuffer{ aCommandBuffer.own() } // Take care of the command_buffer's lifetime.. OMG!
-			](){});
+		const auto firstValue = q.mTimelineValue + 1;
+		q.mTimelineValue += aBatches.size();
+		for (size_t i = 0; i < aBatches.size(); ++i) {
+			auto& b = aBatches[i]->mBatch;
+			const auto token = completion_token{ mQueue, firstValue + i };
+			for (auto& cb : b.mCommandBuffers) {
+				cb->invoke_post_execution_handler();
+				cb->mState = command_buffer_state::submitted;
+				cb->hand_over_completion_handlers(*mCompletionDispatcher, token);
+			}
+			for (auto& callback : b.mCompletionCallbacks) {
+				mCompletionDispatcher->on_completion(token, std::move(callback));
+			}
+			// Keep the command buffers alive until the batch has completed:
+			mCompletionDispatcher->on_completion(token, [lCommandBuffers = std::move(b.mCommandBuffers)]() {});
+			aBatches[i]->mPromise.set_value(token);
 		}
+	}
+#endif
+#pragma endregion
 
-		return signalWhenCompleteSemaphore;
+#pragma region submit batch definitions
+	submit_batch::submit_batch(queue& aQueue, const DISPATCH_LOADER_EXT_TYPE* aSubmit2DispatchLoader)
+		: mQueue{ &aQueue }
+		, mSubmit2DispatchLoader{ aSubmit2DispatchLoader }
+	{
+#if VK_HEADER_VERSION < 204
+		if (nullptr != aSubmit2DispatchLoader) {
+			throw avk::runtime_error("vkQueueSubmit2 requires Vulkan headers of version 1.3.204 or newer.");
+		}
+#endif
 	}
 
-	semaphore queue::submit_and_handle_with_semaphore(std::optional<resource_ownership<command_buffer_t>> aCommandBuffer, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores)
+	submit_batch::submission& submit_batch::add_submission(std::vector<resource_ownership<semaphore_t>>& aWaitSemaphores, std::vector<resource_reference<semaphore_t>>& aSignalSemaphores)
 	{
-		if (!aCommandBuffer.has_value()) {
-			throw avk::runtime_error("std::optional<command_buffer> submitted and it has no value.");
+		auto& s = mSubmissions.emplace_back();
+		for (auto& sema : aWaitSemaphores) {
+			s.mWaitSemaphores.push_back(sema->handle());
+			s.mWaitStages.push_back(sema->semaphore_wait_stage());
+			mOwnedSemaphores.push_back(sema.own());
 		}
-		return submit_and_handle_with_semaphore(std::move(aCommandBuffer.value()), std::move(aWaitSemaphores));
+		for (auto& sema : aSignalSemaphores) {
+			s.mSignalSemaphores.push_back(sema->handle());
+		}
+		return s;
 	}
 
-	// The code between these two ^ and v is mostly copied... I know. It avoids the usage of an unneccessary
-	// temporary vector in single command buffer-case. Should, however, probably be refactored.
-	semaphore queue::submit_and_handle_with_semaphore(std::vector<resource_ownership<command_buffer_t>> aCommandBuffers, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores)
+	submit_batch& submit_batch::add(std::vector<resource_reference<command_buffer_t>> aCommandBuffers, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores, std::vector<resource_reference<semaphore_t>> aSignalSemaphores)
 	{
-		std::vector<vk::CommandBuffer> handles;
-		handles.reserve(aCommandBuffers.size());
+		auto& s = add_submission(aWaitSemaphores, aSignalSemaphores);
+		s.mCommandBuffers = std::move(aCommandBuffers);
+		return *this;
+	}
+
+	submit_batch& submit_batch::add_owned(std::vector<resource_ownership<command_buffer_t>> aCommandBuffers, std::vector<resource_ownership<semaphore_t>> aWaitSemaphores, std::vector<resource_reference<semaphore_t>> aSignalSemaphores)
+	{
+		auto& s = add_submission(aWaitSemaphores, aSignalSemaphores);
+		s.mOwnedCommandBuffers.reserve(aCommandBuffers.size());
 		for (auto& cb : aCommandBuffers) {
-			assert(cb->state() >= command_buffer_state::finished_recording);
-			handles.push_back(cb->handle());
+			s.mOwnedCommandBuffers.push_back(cb.own());
 		}
+		return *this;
+	}
 
-		// Create a semaphore which can, or rather, MUST be used to wait for the results
-		auto signalWhenCompleteSemaphore = root::create_semaphore(mDevice, *mDispatchLoader);
-
-		if (aWaitSemaphores.empty()) {
-			// Optimized route for 0 _WaitSemaphores
-			const auto submitInfo = vk::SubmitInfo{}
-				.setCommandBufferCount(static_cast<uint32_t>(handles.size()))
-				.setPCommandBuffers(handles.data())
-				.setWaitSemaphoreCount(0u)
-				.setPWaitSemaphores(nullptr)
-				.setPWaitDstStageMask(nullptr)
-				.setSignalSemaphoreCount(1u)
-				.setPSignalSemaphores(signalWhenCompleteSemaphore->handle_addr());
+	fence submit_batch::submit()
+	{
+		// Handles of the command buffers of all submissions; the submit infos point into it:
+		std::vector<vk::CommandBuffer> handles;
+		std::vector<uint32_t> firstHandles;
+		firstHandles.reserve(mSubmissions.size() + 1);
+		for (auto& s : mSubmissions) {
+			firstHandles.push_back(static_cast<uint32_t>(handles.size()));
+			for (auto& cb : s.mCommandBuffers) {
+				assert(cb->state() >= command_buffer_state::finished_recording);
+				handles.push_back(cb->handle());
+			}
+			for (auto& cb : s.mOwnedCommandBuffers) {
+				assert(cb->state() >= command_buffer_state::finished_recording);
+				handles.push_back(cb->handle());
+			}
+		}
+		firstHandles.push_back(static_cast<uint32_t>(handles.size()));
 
-			handle().submit({ submitInfo }, nullptr);
-			for (auto& cb : aCommandBuffers) {
-				cb->invoke_post_execution_handler();
+		auto fen = mQueue->get_fence_pool().acquire();
 
-				cb->mState = command_buffer_state::submitted;
+#if VK_HEADER_VERSION >= 204
+		if (nullptr != mSubmit2DispatchLoader) {
+			const auto toStageFlags2 = [](vk::PipelineStageFlags aStages) {
+				// The legacy stage bits have the same values in the 64-bit flags:
+				return vk::PipelineStageFlags2{ static_cast<VkPipelineStageFlags2>(static_cast<VkPipelineStageFlags>(aStages)) };
+			};
+			std::vector<vk::CommandBufferSubmitInfo> commandBufferInfos;
+			commandBufferInfos.reserve(handles.size());
+			for (auto h : handles) {
+				commandBufferInfos.push_back(vk::CommandBufferSubmitInfo{}.setCommandBuffer(h));
+			}
+			// One array per submission, s.t. the submit infos can point into them:
+			std::vector<std::vector<vk::SemaphoreSubmitInfo>> waitInfos(mSubmissions.size());
+			std::vector<std::vector<vk::SemaphoreSubmitInfo>> signalInfos(mSubmissions.size());
+			std::vector<vk::SubmitInfo2> submitInfos;
+			submitInfos.reserve(mSubmissions.size());
+			for (size_t i = 0; i < mSubmissions.size(); ++i) {
+				const auto& s = mSubmissions[i];
+				for (size_t w = 0; w < s.mWaitSemaphores.size(); ++w) {
+					waitInfos[i].push_back(vk::SemaphoreSubmitInfo{}
+						.setSemaphore(s.mWaitSemaphores[w])
+						.setStageMask(toStageFlags2(s.mWaitStages[w]))
+					);
+				}
+				for (auto sema : s.mSignalSemaphores) {
+					signalInfos[i].push_back(vk::SemaphoreSubmitInfo{}
+						.setSemaphore(sema)
+						.setStageMask(vk::PipelineStageFlagBits2::eAllCommands)
+					);
+				}
+				submitInfos.push_back(vk::SubmitInfo2{}
+					.setWaitSemaphoreInfoCount(static_cast<uint32_t>(waitInfos[i].size()))
+					.setPWaitSemaphoreInfos(waitInfos[i].data())
+					.setCommandBufferInfoCount(firstHandles[i + 1] - firstHandles[i])
+					.setPCommandBufferInfos(commandBufferInfos.data() + firstHandles[i])
+					.setSignalSemaphoreInfoCount(static_cast<uint32_t>(signalInfos[i].size()))
+					.setPSignalSemaphoreInfos(signalInfos[i].data())
+				);
 			}
-
-			signalWhenCompleteSemaphore->set_custom_deleter([
-				lOwnedCommandBuffer{ std::move(aCommandBuffers) } // Take care of the command_buffer's lifetime.. OMG!
-			](){});
+			mQueue->handle().submit2(submitInfos, fen->handle(), *mSubmit2DispatchLoader);
 		}
-		else {
-			// Also set the wait semaphores and take care of their lifetimes
-			std::vector<vk::Semaphore> waitSemaphoreHandles;
-			waitSemaphoreHandles.reserve(aWaitSemaphores.size());
-			std::vector<vk::PipelineStageFlags> waitDstStageMasks;
-			waitDstStageMasks.reserve(aWaitSemaphores.size());
-
-			for (const auto& semaphoreDependency : aWaitSemaphores) {
-				waitSemaphoreHandles.push_back(semaphoreDependency->handle());
-				waitDstStageMasks.push_back(semaphoreDependency->semaphore_wait_stage());
+		else
+#endif
+		{
+			std::vector<vk::SubmitInfo> submitInfos;
+			submitInfos.reserve(mSubmissions.size());
+			for (size_t i = 0; i < mSubmissions.size(); ++i) {
+				const auto& s = mSubmissions[i];
+				submitInfos.push_back(vk::SubmitInfo{}
+					.setCommandBufferCount(firstHandles[i + 1] - firstHandles[i])
+					.setPCommandBuffers(handles.data() + firstHandles[i])
+					.setWaitSemaphoreCount(static_cast<uint32_t>(s.mWaitSemaphores.size()))
+					.setPWaitSemaphores(s.mWaitSemaphores.data())
+					.setPWaitDstStageMask(s.mWaitStages.data())
+					.setSignalSemaphoreCount(static_cast<uint32_t>(s.mSignalSemaphores.size()))
+					.setPSignalSemaphores(s.mSignalSemaphores.data())
+				);
 			}
+			mQueue->handle().submit(submitInfos, fen->handle());
+		}
 
-			const auto submitInfo = vk::SubmitInfo{}
-				.setCommandBufferCount(static_cast<uint32_t>(handles.size()))
-				.setPCommandBuffers(handles.data())
-				.setWaitSemaphoreCount(static_cast<uint32_t>(waitSemaphoreHandles.size()))
-				.setPWaitSemaphores(waitSemaphoreHandles.data())
-				.setPWaitDstStageMask(waitDstStageMasks.data())
-				.setSignalSemaphoreCount(1u)
-				.setPSignalSemaphores(signalWhenCompleteSemaphore->handle_addr());
-
-			handle().submit({ submitInfo }, nullptr);
-			for (auto& cb : aCommandBuffers) {
+		std::vector<command_buffer> ownedCommandBuffers;
+		for (auto& s : mSubmissions) {
+			for (auto& cb : s.mCommandBuffers) {
+				cb.get().invoke_post_execution_handler();
+				cb.get().mState = command_buffer_state::submitted;
+			}
+			for (auto& cb : s.mOwnedCommandBuffers) {
 				cb->invoke_post_execution_handler();
-
 				cb->mState = command_buffer_state::submitted;
+				ownedCommandBuffers.push_back(std::move(cb));
 			}
+		}
+		mSubmissions.clear();
 
-			// TODO: Use ranges
-			std::vector<command_buffer> ownedCommandBuffers;
-			for (auto& e : aCommandBuffers) {
-				ownedCommandBuffers.push_back(e.own());
-			}
-			std::vector<semaphore> ownedSemaphores;
-			for (auto& e : aWaitSemaphores) {
-				ownedSemaphores.push_back(e.own());
-			}
-
-			signalWhenCompleteSemaphore->set_custom_deleter([
-				lOwnedWaitSemaphores{ std::move(ownedSemaphores) },
-				lOwnedCommandBuffer{ std::move(aCommandBuffers) } // Take care of the command_buffer's lifetime.. OMG!
+		if (!ownedCommandBuffers.empty() || !mOwnedSemaphores.empty()) {
+			fen->set_custom_deleter([
+				lOwnedCommandBuffers{ std::move(ownedCommandBuffers) },
+				lOwnedWaitSemaphores{ std::move(mOwnedSemaphores) }
 			](){});
+			mOwnedSemaphores.clear();
 		}
-
-		return signalWhenCompleteSemaphore;
+		return fen;
 	}
 #pragma endregion
 
@@ -6447,6 +10151,7 @@ namespace avk
 
 	void root::rewire_config_and_create_ray_tracing_pipeline(ray_tracing_pipeline_t& aPreparedPipeline)
 	{
+		begin_creation_feedback(aPreparedPipeline.mCreationFeedback);
 		assert(aPreparedPipeline.mShaders.size() == aPreparedPipeline.mShaderStageCreateInfos.size());
 		assert(aPreparedPipeline.mShaders.size() == aPreparedPipeline.mSpecializationInfos.size());
 		for (size_t i = 0; i < aPreparedPipeline.mShaders.size(); ++i) {
@@ -6464,12 +10169,11 @@ namespace avk
 
 		// Pipeline Layout must be rewired already before calling this function
 
-		aPreparedPipeline.mPipelineLayout = device().createPipelineLayoutUnique(aPreparedPipeline.mPipelineLayoutCreateInfo, nullptr, dispatch_loader_core());
-		assert(aPreparedPipeline.layout_handle());
-
-
-		// Create the PIPELINE LAYOUT
-		aPreparedPipeline.mPipelineLayout = device().createPipelineLayoutUnique(aPreparedPipeline.mPipelineLayoutCreateInfo, nullptr, dispatch_loader_core());
+		// Create the PIPELINE LAYOUT, or reuse an identical one
+		aPreparedPipeline.mPipelineLayout = timed(aPreparedPipeline.mCreationFeedback.mLayoutCreationDuration, [&] {
+			return global_layout_registry().get_or_create_pipeline_layout(device(), dispatch_loader_core(), aPreparedPipeline.mAllDescriptorSetLayouts, aPreparedPipeline.mPushConstantRanges, aPreparedPipeline.mPipelineLayoutCreateInfo.flags);
+		});
+		aPreparedPipeline.mPipelineLayoutCreateInfo = aPreparedPipeline.mPipelineLayout->create_info();
 		assert(static_cast<bool>(aPreparedPipeline.layout_handle()));
 
 		auto pipelineCreateInfo = vk::RayTracingPipelineCreateInfoKHR{}
@@ -6485,7 +10189,13 @@ namespace avk
 			.setMaxRecursionDepth(aPreparedPipeline.mMaxRecursionDepth)
 #endif
 			.setLayout(aPreparedPipeline.layout_handle());
-		
+
+		std::optional<driver_feedback_request> driverFeedback;
+		if (pipeline_creation_statistics::is_driver_feedback_enabled()) {
+			driverFeedback.emplace(static_cast<uint32_t>(aPreparedPipeline.mShaderStageCreateInfos.size()));
+			pipelineCreateInfo.setPNext(&driverFeedback->mCreateInfo);
+		}
+		const auto pipelineCreationStart = std::chrono::steady_clock::now();
 #if VK_HEADER_VERSION >= 162
 		auto pipeCreationResult = device().createRayTracingPipelineKHRUnique(
 			{}, {},
@@ -6501,6 +10211,8 @@ namespace avk
 #endif
 
 		aPreparedPipeline.mPipeline = std::move(pipeCreationResult.value);
+		aPreparedPipeline.mCreationFeedback.mPipelineCreationDuration += elapsed_since(pipelineCreationStart);
+		finish_creation_feedback(aPreparedPipeline.mCreationFeedback, driverFeedback, references_to(aPreparedPipeline.mShaders), "ray tracing");
 	}
 
 	void root::build_shader_binding_table(ray_tracing_pipeline_t& aPipeline)
@@ -6590,6 +10302,11 @@ namespace avk
 		if ((aConfig.mPipelineSettings & pipeline_settings::disable_optimization) == pipeline_settings::disable_optimization) {
 			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDisableOptimization;
 		}
+#if VK_HEADER_VERSION >= 235
+		if ((aConfig.mPipelineSettings & pipeline_settings::descriptor_buffer) == pipeline_settings::descriptor_buffer) {
+			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDescriptorBufferEXT;
+		}
+#endif
 
 		// Get the offsets. We'll really need them in step 10. but already in step 3., we are gathering the correct byte offsets:
 		{
@@ -6641,7 +10358,7 @@ namespace avk
 		result.mSpecializationInfos.reserve(orderedUniqueShaderInfos.size());
 		for (auto& shaderInfo : orderedUniqueShaderInfos) {
 			// 2.2 Compile the shader
-			result.mShaders.push_back(create_shader(shaderInfo));
+			result.mShaders.push_back(timed(result.mCreationFeedback.mShaderLoadDuration, [&] { return create_shader(shaderInfo); }));
 			assert(result.mShaders.back().has_been_built());
 			// 2.3 Create shader info
 			auto& stageCreateInfo = result.mShaderStageCreateInfos.emplace_back()
@@ -6795,7 +10512,12 @@ namespace avk
 
 		// 5. Pipeline layout
 		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings));
-		allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts);
+#if VK_HEADER_VERSION >= 235
+		if (avk::has_flag(result.mPipelineCreateFlags, vk::PipelineCreateFlagBits::eDescriptorBufferEXT)) {
+			prepare_for_descriptor_buffers(result.mAllDescriptorSetLayouts);
+		}
+#endif
+		timed(result.mCreationFeedback.mLayoutCreationDuration, [&] { allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts); });
 
 		// Gather the push constant data
 		result.mPushConstantRanges.reserve(aConfig.mPushConstantsBindings.size()); // Important! Otherwise the vector might realloc and .data() will become invalid!
@@ -6835,7 +10557,7 @@ namespace avk
 
 		result.mPipelineCreateFlags						= aTemplate->mPipelineCreateFlags;
 		for (const auto& shdr : aTemplate->mShaders) {
-			result.mShaders.push_back(create_shader_from_template(shdr));
+			result.mShaders.push_back(timed(result.mCreationFeedback.mShaderLoadDuration, [&] { return create_shader_from_template(shdr); }));
 		}
 		result.mShaderStageCreateInfos					= aTemplate->mShaderStageCreateInfos;
 		result.mSpecializationInfos						= aTemplate->mSpecializationInfos;
@@ -6843,7 +10565,7 @@ namespace avk
 		result.mShaderBindingTableGroupsInfo			= aTemplate->mShaderBindingTableGroupsInfo;
 		result.mMaxRecursionDepth						= aTemplate->mMaxRecursionDepth;
 		result.mBasePipelineIndex						= aTemplate->mBasePipelineIndex;
-		result.mAllDescriptorSetLayouts = create_set_of_descriptor_set_layouts_from_template(aTemplate->mAllDescriptorSetLayouts);
+		result.mAllDescriptorSetLayouts = timed(result.mCreationFeedback.mLayoutCreationDuration, [&] { return create_set_of_descriptor_set_layouts_from_template(aTemplate->mAllDescriptorSetLayouts); });
 		result.mPushConstantRanges						= aTemplate->mPushConstantRanges;
 
 		auto descriptorSetLayoutHandles = result.mAllDescriptorSetLayouts.layout_handles();
@@ -7581,17 +11303,14 @@ namespace avk
 		: mCreateInfo{}
 		, mSemaphore{}
 		, mSemaphoreWaitStageForNextCommand{ vk::PipelineStageFlagBits::eAllCommands }
-		, mCustomDeleter{}
+		, mCustomDeleters{}
 	{
 	}
 
 	semaphore_t::~semaphore_t()
 	{
-		if (mCustomDeleter.has_value() && *mCustomDeleter) {
-			// If there is a custom deleter => call it now
-			(*mCustomDeleter)();
-			mCustomDeleter.reset();
-		}
+		// If there are custom deleters => call them now
+		invoke_in_reverse_order_and_clear(mCustomDeleters);
 		// Destroy the dependant instance before destroying myself
 		// ^ This is ensured by the order of the members
 		//   See: https://isocpp.org/wiki/faq/dtors#calling-member-dtors
@@ -7640,6 +11359,15 @@ namespace avk
 		return device().createShaderModuleUnique(createInfo, nullptr, dispatch_loader_core());
 	}
 
+	vk::UniqueHandle<vk::ShaderModule, DISPATCH_LOADER_CORE_TYPE> root::build_shader_module_from_binary_code(std::span<const uint32_t> aCode)
+	{
+		auto createInfo = vk::ShaderModuleCreateInfo()
+			.setCodeSize(aCode.size_bytes())
+			.setPCode(aCode.data());
+
+		return device().createShaderModuleUnique(createInfo, nullptr, dispatch_loader_core());
+	}
+
 	vk::UniqueHandle<vk::ShaderModule, DISPATCH_LOADER_CORE_TYPE> root::build_shader_module_from_file(const std::string& aPath)
 	{
 		auto binFileContents = avk::load_binary_file(aPath);
@@ -7650,6 +11378,17 @@ namespace avk
 	{
 		auto shdr = shader::prepare(std::move(aInfo));
 
+		// Mounted shader archives take precedence over individual files:
+		for (const auto& path : { shdr.info().mPath, shdr.info().mPath + ".spv" }) {
+			// Holds the archive's mapping, s.t. the code stays valid even if the archive is unmounted concurrently:
+			auto archived = shader_archive::find_in_mounted(path);
+			if (archived.has_value()) {
+				shdr.mShaderModule = build_shader_module_from_binary_code(archived->mCode);
+				shdr.mActualShaderLoadPath = archived->mArchivePath + ":" + path;
+				return shdr;
+			}
+		}
+
 		if (std::filesystem::exists(shdr.info().mPath)) {
 			try {
 				shdr.mShaderModule = build_shader_module_from_file(shdr.info().mPath);
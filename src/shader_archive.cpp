@@ -0,0 +1,167 @@
+#define NOMINMAX
+#include <avk/avk.hpp>
+
+// The platform headers are confined to this translation unit. windows.h defines macros like
+// MemoryBarrier, which collide with Vulkan-Hpp names used in avk.cpp.
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace avk
+{
+#pragma region shader archive definitions
+	namespace
+	{
+		// All archives which have been mounted via shader_archive::mount, in mounting order
+		std::vector<shader_archive>& mounted_shader_archives()
+		{
+			static std::vector<shader_archive> sMountedArchives;
+			return sMountedArchives;
+		}
+
+		std::mutex& mounted_shader_archives_mutex()
+		{
+			static std::mutex sMutex;
+			return sMutex;
+		}
+	}
+
+	shader_archive shader_archive::open(std::string aPath)
+	{
+		shader_archive result;
+		result.mPath = std::move(aPath);
+
+#if defined(_WIN32)
+		HANDLE file = CreateFileA(result.mPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (INVALID_HANDLE_VALUE == file) {
+			throw avk::runtime_error("Couldn't open shader archive '" + result.mPath + "'");
+		}
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize)) {
+			CloseHandle(file);
+			throw avk::runtime_error("Couldn't determine the size of shader archive '" + result.mPath + "'");
+		}
+		result.mMappingSize = static_cast<size_t>(fileSize.QuadPart);
+		HANDLE mapping = 0 == result.mMappingSize ? nullptr : CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		// The mapping keeps the file alive
+		CloseHandle(file);
+		if (nullptr == mapping) {
+			throw avk::runtime_error("Couldn't map shader archive '" + result.mPath + "'");
+		}
+		const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (nullptr == view) {
+			throw avk::runtime_error("Couldn't map shader archive '" + result.mPath + "'");
+		}
+		result.mMapping = std::shared_ptr<const std::byte>(static_cast<const std::byte*>(view), [](const std::byte* aView) {
+			UnmapViewOfFile(aView);
+		});
+#else
+		const int file = ::open(result.mPath.c_str(), O_RDONLY);
+		if (-1 == file) {
+			throw avk::runtime_error("Couldn't open shader archive '" + result.mPath + "'");
+		}
+		struct stat fileStat;
+		if (-1 == fstat(file, &fileStat)) {
+			::close(file);
+			throw avk::runtime_error("Couldn't determine the size of shader archive '" + result.mPath + "'");
+		}
+		result.mMappingSize = static_cast<size_t>(fileStat.st_size);
+		void* view = 0 == result.mMappingSize ? MAP_FAILED : mmap(nullptr, result.mMappingSize, PROT_READ, MAP_PRIVATE, file, 0);
+		// The mapping keeps the file alive
+		::close(file);
+		if (MAP_FAILED == view) {
+			throw avk::runtime_error("Couldn't map shader archive '" + result.mPath + "'");
+		}
+		result.mMapping = std::shared_ptr<const std::byte>(static_cast<const std::byte*>(view), [size = result.mMappingSize](const std::byte* aView) {
+			munmap(const_cast<std::byte*>(aView), size);
+		});
+#endif
+
+		// Validate the header and the index, so that find() does not need to check anything but the hash:
+		if (result.mMappingSize < sizeof(shader_archive_header)) {
+			throw avk::runtime_error("'" + result.mPath + "' is not a shader archive: The file is too small.");
+		}
+		shader_archive_header header;
+		memcpy(&header, result.mMapping.get(), sizeof(header));
+		if (shader_archive_magic != header.mMagic) {
+			throw avk::runtime_error("'" + result.mPath + "' is not a shader archive: Wrong magic number.");
+		}
+		if (shader_archive_version != header.mVersion) {
+			throw avk::runtime_error("Shader archive '" + result.mPath + "' has version " + std::to_string(header.mVersion) + ", but only version " + std::to_string(shader_archive_version) + " is supported.");
+		}
+		const auto indexEnd = sizeof(shader_archive_header) + static_cast<size_t>(header.mEntryCount) * sizeof(shader_archive_entry);
+		if (indexEnd > result.mMappingSize) {
+			throw avk::runtime_error("Shader archive '" + result.mPath + "' is truncated: The index does not fit into the file.");
+		}
+		result.mEntries = std::span<const shader_archive_entry>(reinterpret_cast<const shader_archive_entry*>(result.mMapping.get() + sizeof(shader_archive_header)), header.mEntryCount);
+		for (size_t i = 0; i < result.mEntries.size(); ++i) {
+			const auto& entry = result.mEntries[i];
+			if (0 != entry.mOffset % shader_archive_blob_alignment || 0 != entry.mSize % sizeof(uint32_t)
+				|| entry.mOffset < indexEnd || entry.mOffset > result.mMappingSize || entry.mSize > result.mMappingSize - entry.mOffset) {
+				throw avk::runtime_error("Shader archive '" + result.mPath + "' is corrupt: Entry " + std::to_string(i) + " is out of bounds or misaligned.");
+			}
+			if (i > 0 && result.mEntries[i - 1].mPathHash >= entry.mPathHash) {
+				throw avk::runtime_error("Shader archive '" + result.mPath + "' is corrupt: The index is not sorted.");
+			}
+		}
+
+		return result;
+	}
+
+	std::optional<std::span<const uint32_t>> shader_archive::find(std::string_view aShaderPath) const
+	{
+		const auto hash = shader_archive_path_hash(aShaderPath);
+		const auto it = std::lower_bound(std::begin(mEntries), std::end(mEntries), hash, [](const shader_archive_entry& aEntry, uint64_t aHash) {
+			return aEntry.mPathHash < aHash;
+		});
+		if (std::end(mEntries) == it || it->mPathHash != hash) {
+			return {};
+		}
+		return std::span<const uint32_t>(reinterpret_cast<const uint32_t*>(mMapping.get() + it->mOffset), static_cast<size_t>(it->mSize / sizeof(uint32_t)));
+	}
+
+	void shader_archive::mount(std::string aPath)
+	{
+		auto archive = open(std::move(aPath));
+		std::scoped_lock lock(mounted_shader_archives_mutex());
+		mounted_shader_archives().push_back(std::move(archive));
+	}
+
+	void shader_archive::unmount(std::string_view aPath)
+	{
+		std::scoped_lock lock(mounted_shader_archives_mutex());
+		auto& archives = mounted_shader_archives();
+		archives.erase(std::remove_if(std::begin(archives), std::end(archives), [aPath](const shader_archive& aArchive) {
+			return are_paths_equal(aArchive.path(), aPath);
+		}), std::end(archives));
+	}
+
+	void shader_archive::unmount_all()
+	{
+		std::scoped_lock lock(mounted_shader_archives_mutex());
+		mounted_shader_archives().clear();
+	}
+
+	std::optional<shader_archive::mounted_shader_code> shader_archive::find_in_mounted(std::string_view aShaderPath)
+	{
+		std::scoped_lock lock(mounted_shader_archives_mutex());
+		const auto& archives = mounted_shader_archives();
+		for (auto it = archives.rbegin(); it != archives.rend(); ++it) {
+			auto code = it->find(aShaderPath);
+			if (code.has_value()) {
+				return mounted_shader_code{ it->path(), *code, it->mMapping };
+			}
+		}
+		return {};
+	}
+#pragma endregion
+}
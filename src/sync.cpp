@@ -2,7 +2,7 @@
 
 namespace avk
 {
-	command_pool sync::sPoolToAllocCommandBuffersFrom;
+	command_pool_manager sync::sCommandPoolManager;
 	queue* sync::sQueueToUse;
 	
 	void sync::presets::default_handler_before_operation(command_buffer_t& aCommandBuffer, pipeline_stage aDestinationStage, std::optional<read_memory_access> aDestinationAccess)
@@ -85,6 +85,11 @@ namespace avk
 		, mCommandbufferRequest { std::move(aOther.mCommandbufferRequest) }
 		, mSemaphoreLifetimeHandler{ std::move(aOther.mSemaphoreLifetimeHandler) }
 		, mWaitBeforeSemaphores{ std::move(aOther.mWaitBeforeSemaphores) }
+#if VK_HEADER_VERSION >= 135
+		, mCompletionTokenHandler{ std::move(aOther.mCompletionTokenHandler) }
+		, mWaitBeforeTokens{ std::move(aOther.mWaitBeforeTokens) }
+#endif
+		, mBatch{ std::exchange(aOther.mBatch, nullptr) }
 		, mCommandBufferRefOrLifetimeHandler{ std::move(aOther.mCommandBufferRefOrLifetimeHandler) }
 		, mCommandBuffer{ std::move(aOther.mCommandBuffer) }
 		, mEstablishBarrierBeforeOperationCallback{ std::move(aOther.mEstablishBarrierBeforeOperationCallback) }
@@ -95,6 +100,10 @@ namespace avk
 		aOther.mSpecialSync = sync_type::not_required;
 		aOther.mSemaphoreLifetimeHandler = {};
 		aOther.mWaitBeforeSemaphores.clear();
+#if VK_HEADER_VERSION >= 135
+		aOther.mCompletionTokenHandler = {};
+		aOther.mWaitBeforeTokens.clear();
+#endif
 		aOther.mCommandBufferRefOrLifetimeHandler = {};
 		aOther.mCommandBuffer.reset();
 		aOther.mEstablishBarrierBeforeOperationCallback = {};
@@ -109,6 +118,11 @@ namespace avk
 		mCommandbufferRequest = std::move(aOther.mCommandbufferRequest);
 		mSemaphoreLifetimeHandler = std::move(aOther.mSemaphoreLifetimeHandler);
 		mWaitBeforeSemaphores = std::move(aOther.mWaitBeforeSemaphores);
+#if VK_HEADER_VERSION >= 135
+		mCompletionTokenHandler = std::move(aOther.mCompletionTokenHandler);
+		mWaitBeforeTokens = std::move(aOther.mWaitBeforeTokens);
+#endif
+		mBatch = std::exchange(aOther.mBatch, nullptr);
 		mCommandBufferRefOrLifetimeHandler = std::move(aOther.mCommandBufferRefOrLifetimeHandler);
 		mCommandBuffer = std::move(aOther.mCommandBuffer);
 		mEstablishBarrierBeforeOperationCallback = std::move(aOther.mEstablishBarrierBeforeOperationCallback);
@@ -119,6 +133,10 @@ namespace avk
 		aOther.mSpecialSync = sync_type::not_required;
 		aOther.mSemaphoreLifetimeHandler = {};
 		aOther.mWaitBeforeSemaphores.clear();
+#if VK_HEADER_VERSION >= 135
+		aOther.mCompletionTokenHandler = {};
+		aOther.mWaitBeforeTokens.clear();
+#endif
 		aOther.mCommandBufferRefOrLifetimeHandler = {};
 		aOther.mCommandBuffer.reset();
 		aOther.mEstablishBarrierBeforeOperationCallback = {};
@@ -233,6 +251,14 @@ namespace avk
 		if (mSemaphoreLifetimeHandler) {
 			return sync_type::via_semaphore;
 		}
+#if VK_HEADER_VERSION >= 135
+		if (mCompletionTokenHandler) {
+			return sync_type::via_completion_token;
+		}
+#endif
+		if (nullptr != mBatch) {
+			return sync_type::via_batch;
+		}
 		if (!std::holds_alternative<std::monostate>(mCommandBufferRefOrLifetimeHandler)) {
 			return sync_type::via_barrier;
 		}
@@ -274,12 +300,14 @@ namespace avk
 		}
 
 		if (!mCommandBuffer.has_value()) {
+			// Each thread allocates from its own pool, hence implicit command buffers can be created on worker threads:
+			const auto queueFamilyIndex = queue_to_use().get().family_index();
 			switch (mCommandbufferRequest) {
 			case commandbuffer_request::reusable:
-				mCommandBuffer = sPoolToAllocCommandBuffersFrom->alloc_command_buffer({});
+				mCommandBuffer = sCommandPoolManager.alloc_command_buffer(queueFamilyIndex, {});
 				break;
 			default:
-				mCommandBuffer = sPoolToAllocCommandBuffersFrom->alloc_command_buffer(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+				mCommandBuffer = sCommandPoolManager.alloc_command_buffer(queueFamilyIndex, vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
 				break;
 			}
 			mCommandBuffer.value()->begin_recording(); // Immediately start recording
@@ -350,6 +378,39 @@ namespace avk
 				mWaitBeforeSemaphores.clear();				// Never ever use them again (they have been moved from)
 			}
 			break;
+#if VK_HEADER_VERSION >= 135
+		case sync_type::via_completion_token:
+			{
+				assert(mCompletionTokenHandler);
+				assert(mCommandBuffer.has_value());
+				// No barrier required, the timeline semaphore's signal and wait operations establish the memory dependency:
+				mCommandBuffer.value()->end_recording();	// What started in get_or_create_command_buffer() ends here.
+				auto token = queue.submit_with_completion_token({ referenced(mCommandBuffer.value()) }, std::move(mWaitBeforeTokens));
+				mCompletionTokenHandler(token, std::move(mCommandBuffer.value())); // Transfer ownership and be done with it
+				mCommandBuffer.reset();						// Command buffer has been moved from. It's gone.
+				mWaitBeforeTokens.clear();
+			}
+			break;
+#endif
+		case sync_type::via_batch:
+			{
+				assert(nullptr != mBatch);
+				assert(mCommandBuffer.has_value());
+				if (mBatch->get_queue().family_index() != queue.family_index()) {
+					throw avk::runtime_error("The submit_batch's queue must be of the same family as the queue which the implicit command buffer has been allocated for.");
+				}
+				mCommandBuffer.value()->establish_global_memory_barrier(
+					pipeline_stage::all_commands, 
+					pipeline_stage::all_commands, 
+					std::optional<memory_access>{memory_access::any_access}, 
+					std::optional<memory_access>{memory_access::any_access});
+				mCommandBuffer.value()->end_recording();	// What started in get_or_create_command_buffer() ends here.
+				std::vector<resource_ownership<command_buffer_t>> commandBuffers;
+				commandBuffers.push_back(owned(mCommandBuffer.value()));
+				mBatch->add_owned(std::move(commandBuffers));
+				mCommandBuffer.reset();						// Command buffer has been moved from. It's gone.
+			}
+			break;
 		case sync_type::via_barrier:
 			assert(!std::holds_alternative<std::monostate>(mCommandBufferRefOrLifetimeHandler));
 			if (std::holds_alternative<unique_function<void(command_buffer)>>(mCommandBufferRefOrLifetimeHandler)) {
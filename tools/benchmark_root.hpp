@@ -0,0 +1,97 @@
+#pragma once
+// A headless root for the benchmarks: It creates a Vulkan 1.2 instance, and a device with one
+// versatile queue on the first physical device, with the timelineSemaphore feature enabled.
+#include <avk/avk.hpp>
+
+class benchmark_root : public avk::root
+{
+public:
+	benchmark_root()
+	{
+		if constexpr (std::is_same_v<std::remove_cv_t<decltype(mDispatchLoaderCore)>, vk::DispatchLoaderDynamic>) {
+			reinterpret_cast<vk::DispatchLoaderDynamic*>(&mDispatchLoaderCore)->init(vkGetInstanceProcAddr);
+		}
+		const auto appInfo = vk::ApplicationInfo{}.setApiVersion(VK_API_VERSION_1_2);
+		mInstance = vk::createInstanceUnique(vk::InstanceCreateInfo{}.setPApplicationInfo(&appInfo), nullptr, mDispatchLoaderCore);
+		if constexpr (std::is_same_v<std::remove_cv_t<decltype(mDispatchLoaderCore)>, vk::DispatchLoaderDynamic>) {
+			reinterpret_cast<vk::DispatchLoaderDynamic*>(&mDispatchLoaderCore)->init(mInstance.get());
+		}
+		mPhysicalDevice = mInstance->enumeratePhysicalDevices(mDispatchLoaderCore).front();
+
+		const auto familyIndex = avk::queue::select_queue_family_index(mPhysicalDevice, {}, avk::queue_selection_preference::versatile_queue);
+		auto queues = avk::make_vector(avk::queue::prepare(mPhysicalDevice, mDispatchLoaderCore, familyIndex, 0));
+		auto config = avk::queue::get_queue_config_for_DeviceCreateInfo(std::begin(queues), std::end(queues));
+		for (size_t i = 0; i < std::get<0>(config).size(); ++i) {
+			std::get<0>(config)[i].setPQueuePriorities(std::get<1>(config)[i].data());
+		}
+
+		auto features12 = vk::PhysicalDeviceVulkan12Features{}.setTimelineSemaphore(VK_TRUE);
+		const auto deviceCreateInfo = vk::DeviceCreateInfo{}
+			.setPNext(&features12)
+			.setQueueCreateInfoCount(static_cast<uint32_t>(std::get<0>(config).size()))
+			.setPQueueCreateInfos(std::get<0>(config).data());
+		mDevice = mPhysicalDevice.createDeviceUnique(deviceCreateInfo, nullptr, mDispatchLoaderCore);
+		avk::root::record_enabled_device_extensions(mDevice.get(), deviceCreateInfo);
+
+		if constexpr (std::is_same_v<std::remove_cv_t<decltype(mDispatchLoaderCore)>, vk::DispatchLoaderDynamic>) {
+			reinterpret_cast<vk::DispatchLoaderDynamic*>(&mDispatchLoaderCore)->init(mDevice.get());
+		}
+		if constexpr (std::is_same_v<std::remove_cv_t<decltype(mDispatchLoaderExt)>, vk::DispatchLoaderDynamic>) {
+			reinterpret_cast<vk::DispatchLoaderDynamic*>(&mDispatchLoaderExt)->init(mInstance.get(), vkGetInstanceProcAddr, mDevice.get());
+		}
+
+		queues[0].assign_handle(mDevice.get());
+		mQueue = std::move(queues[0]);
+
+#if defined(AVK_USE_VMA)
+		VmaAllocatorCreateInfo allocatorInfo = {};
+		allocatorInfo.physicalDevice = mPhysicalDevice;
+		allocatorInfo.device = mDevice.get();
+		allocatorInfo.instance = mInstance.get();
+		vmaCreateAllocator(&allocatorInfo, &mMemoryAllocator);
+#else
+		mMemoryAllocator = std::make_tuple(mPhysicalDevice, mDevice.get());
+#endif
+	}
+
+	benchmark_root(benchmark_root&&) = delete;
+	benchmark_root(const benchmark_root&) = delete;
+	benchmark_root& operator=(benchmark_root&&) = delete;
+	benchmark_root& operator=(const benchmark_root&) = delete;
+
+	~benchmark_root()
+	{
+		mDevice->waitIdle(mDispatchLoaderCore);
+		mQueue.release_sync_objects();
+#if defined(AVK_USE_VMA)
+		vmaDestroyAllocator(mMemoryAllocator);
+#endif
+		avk::root::forget_enabled_device_extensions(mDevice.get());
+	}
+
+	avk::queue& queue() { return mQueue; }
+
+	vk::PhysicalDevice& physical_device() override { return mPhysicalDevice; }
+	const vk::PhysicalDevice& physical_device() const override { return mPhysicalDevice; }
+	vk::Device& device() override { return *mDevice; }
+	const vk::Device& device() const override { return *mDevice; }
+	DISPATCH_LOADER_CORE_TYPE& dispatch_loader_core() override { return mDispatchLoaderCore; }
+	const DISPATCH_LOADER_CORE_TYPE& dispatch_loader_core() const override { return mDispatchLoaderCore; }
+	DISPATCH_LOADER_EXT_TYPE& dispatch_loader_ext() override { return mDispatchLoaderExt; }
+	const DISPATCH_LOADER_EXT_TYPE& dispatch_loader_ext() const override { return mDispatchLoaderExt; }
+	AVK_MEM_ALLOCATOR_TYPE& memory_allocator() override { return mMemoryAllocator; }
+	const AVK_MEM_ALLOCATOR_TYPE& memory_allocator() const override { return mMemoryAllocator; }
+
+private:
+	DISPATCH_LOADER_CORE_TYPE mDispatchLoaderCore;
+	DISPATCH_LOADER_EXT_TYPE mDispatchLoaderExt;
+	vk::UniqueHandle<vk::Instance, DISPATCH_LOADER_CORE_TYPE> mInstance;
+	vk::PhysicalDevice mPhysicalDevice;
+	vk::UniqueHandle<vk::Device, DISPATCH_LOADER_CORE_TYPE> mDevice;
+	avk::queue mQueue;
+#if defined(AVK_USE_VMA)
+	VmaAllocator mMemoryAllocator;
+#else
+	std::tuple<vk::PhysicalDevice, vk::Device> mMemoryAllocator;
+#endif
+};
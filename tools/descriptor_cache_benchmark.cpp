@@ -0,0 +1,270 @@
+// Exercises avk::descriptor_cache from multiple threads.
+//
+// Usage: avk_descriptor_cache_benchmark stress [<threads> [<iterations-per-thread>]]
+//        avk_descriptor_cache_benchmark scaling [<max-threads> [<lookups-per-thread>]]
+//        avk_descriptor_cache_benchmark latency [<threads (ignored)> [<lookups>]]
+//
+// stress:  Threads request random combinations of bindings concurrently, s.t. cache hits and the
+//          creation of new sets race with each other. Every combination must have resolved to the
+//          same set on all threads, and different combinations to different sets. Afterwards, the
+//          same requests run against a cache with a limit, while the main thread advances frames and
+//          evicts sets. Returns a non-zero exit code if a check fails.
+// scaling: Measures the throughput of cache hits with 1, 2, 4, ... threads, up to <max-threads>.
+// latency: Measures the time of a single cache hit on one thread, for a set of sNumberOfLatencyBindings
+//          sampler bindings which is already in the cache.
+#include <avk/avk.hpp>
+#include "benchmark_root.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	// The sets are made of two sampler bindings, i.e., there are sNumberOfSamplers^2 distinct sets:
+	constexpr uint32_t sNumberOfSamplers = 32;
+	constexpr uint32_t sNumberOfCombinations = sNumberOfSamplers * sNumberOfSamplers;
+	// The number of bindings of the set which the latency mode looks up:
+	constexpr uint32_t sNumberOfLatencyBindings = 8;
+
+	std::vector<avk::sampler> create_samplers(benchmark_root& aRoot)
+	{
+		std::vector<avk::sampler> samplers;
+		for (uint32_t i = 0; i < sNumberOfSamplers; ++i) {
+			// Different max. LODs, s.t. no two samplers are alike:
+			samplers.push_back(aRoot.create_sampler(avk::filter_mode::nearest_neighbor, avk::border_handling_mode::clamp_to_edge, static_cast<float>(i)));
+		}
+		return samplers;
+	}
+
+	vk::DescriptorSet get_set(avk::descriptor_cache& aCache, const std::vector<avk::sampler>& aSamplers, uint32_t aCombination, std::vector<avk::descriptor_set>& aResult)
+	{
+		aCache.get_or_create_descriptor_sets({
+			avk::descriptor_binding(0, 0, aSamplers[aCombination / sNumberOfSamplers]),
+			avk::descriptor_binding(0, 1, aSamplers[aCombination % sNumberOfSamplers])
+		}, aResult);
+		if (1 != aResult.size() || !aResult.front().handle()) {
+			throw avk::runtime_error("descriptor_cache returned an unexpected result for combination " + std::to_string(aCombination));
+		}
+		return aResult.front().handle();
+	}
+
+	template <typename F>
+	void run_on_threads(uint32_t aNumThreads, F&& aFunc)
+	{
+		std::vector<std::thread> threads;
+		std::vector<std::exception_ptr> errors(aNumThreads);
+		for (uint32_t t = 0; t < aNumThreads; ++t) {
+			threads.emplace_back([&, t]() {
+				try {
+					aFunc(t);
+				}
+				catch (...) {
+					errors[t] = std::current_exception();
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		for (auto& error : errors) {
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+	}
+
+	bool stress(benchmark_root& aRoot, uint32_t aNumThreads, uint32_t aIterations)
+	{
+		const auto samplers = create_samplers(aRoot);
+		bool ok = true;
+
+		// Unlimited cache: Every combination must resolve to exactly one set.
+		{
+			auto cache = aRoot.create_descriptor_cache("stress test");
+			std::vector<std::vector<vk::DescriptorSet>> seen(aNumThreads, std::vector<vk::DescriptorSet>(sNumberOfCombinations));
+			run_on_threads(aNumThreads, [&](uint32_t t) {
+				std::mt19937 rng{ t };
+				std::uniform_int_distribution<uint32_t> dist{ 0, sNumberOfCombinations - 1 };
+				std::vector<avk::descriptor_set> result;
+				for (uint32_t i = 0; i < aIterations; ++i) {
+					const auto combination = dist(rng);
+					const auto set = get_set(cache, samplers, combination, result);
+					auto& s = seen[t][combination];
+					if (!s) {
+						s = set;
+					}
+					else if (s != set) {
+						throw avk::runtime_error("Combination " + std::to_string(combination) + " resolved to different sets on the same thread.");
+					}
+				}
+			});
+
+			std::vector<vk::DescriptorSet> sets(sNumberOfCombinations);
+			std::unordered_map<VkDescriptorSet, uint32_t> combinations;
+			for (uint32_t c = 0; c < sNumberOfCombinations; ++c) {
+				for (uint32_t t = 0; t < aNumThreads; ++t) {
+					const auto set = seen[t][c];
+					if (!set) {
+						continue;
+					}
+					if (!sets[c]) {
+						sets[c] = set;
+						const auto [it, inserted] = combinations.emplace(static_cast<VkDescriptorSet>(set), c);
+						if (!inserted) {
+							std::cerr << "Combinations " << it->second << " and " << c << " resolved to the same set.\n";
+							ok = false;
+						}
+					}
+					else if (sets[c] != set) {
+						std::cerr << "Combination " << c << " resolved to different sets on different threads.\n";
+						ok = false;
+					}
+				}
+			}
+			std::cout << "stress test, unlimited cache: " << combinations.size() << " distinct sets requested by " << aNumThreads << " threads, " << (ok ? "consistent" : "INCONSISTENT") << "\n";
+		}
+
+		// Limited cache: Lookups, creations, and evictions race with each other.
+		{
+			auto cache = aRoot.create_descriptor_cache("stress test with eviction");
+			cache.set_max_number_of_sets(sNumberOfCombinations / 4, 2);
+			std::atomic<bool> done{ false };
+			size_t numEvicted = 0;
+			uint64_t numFrames = 0;
+			std::thread frames([&]() {
+				while (!done.load(std::memory_order_acquire)) {
+					numEvicted += cache.next_frame();
+					++numFrames;
+					std::this_thread::sleep_for(std::chrono::microseconds{ 200 });
+				}
+			});
+			try {
+				run_on_threads(aNumThreads, [&](uint32_t t) {
+					std::mt19937 rng{ 1000 + t };
+					std::uniform_int_distribution<uint32_t> dist{ 0, sNumberOfCombinations - 1 };
+					std::vector<avk::descriptor_set> result;
+					for (uint32_t i = 0; i < aIterations; ++i) {
+						get_set(cache, samplers, dist(rng), result);
+					}
+				});
+			}
+			catch (...) {
+				done = true;
+				frames.join();
+				throw;
+			}
+			done = true;
+			frames.join();
+			std::cout << "stress test, limited cache: " << numFrames << " frames, " << numEvicted << " sets evicted\n";
+		}
+		return ok;
+	}
+
+	void scaling(benchmark_root& aRoot, uint32_t aMaxThreads, uint32_t aLookups)
+	{
+		const auto samplers = create_samplers(aRoot);
+		auto cache = aRoot.create_descriptor_cache("scaling benchmark");
+		// Fill the cache, s.t. only cache hits are measured:
+		{
+			std::vector<avk::descriptor_set> result;
+			for (uint32_t c = 0; c < sNumberOfCombinations; ++c) {
+				get_set(cache, samplers, c, result);
+			}
+		}
+
+		double singleThreaded = 0.0;
+		for (uint32_t numThreads = 1; numThreads <= aMaxThreads; numThreads *= 2) {
+			const auto start = clock_type::now();
+			run_on_threads(numThreads, [&](uint32_t t) {
+				std::vector<avk::descriptor_set> result;
+				result.reserve(1);
+				for (uint32_t i = 0; i < aLookups; ++i) {
+					get_set(cache, samplers, (i * 7919u + t * 104729u) % sNumberOfCombinations, result);
+				}
+			});
+			const auto seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+			const auto throughput = static_cast<double>(numThreads) * aLookups / seconds;
+			if (1 == numThreads) {
+				singleThreaded = throughput;
+			}
+			std::cout << numThreads << " thread(s): " << throughput << " lookups/s, speedup " << throughput / singleThreaded << "\n";
+		}
+	}
+
+	void latency(benchmark_root& aRoot, uint32_t aLookups)
+	{
+		const auto samplers = create_samplers(aRoot);
+		auto cache = aRoot.create_descriptor_cache("latency benchmark");
+		const auto lookup = [&](std::vector<avk::descriptor_set>& aResult) {
+			cache.get_or_create_descriptor_sets({
+				avk::descriptor_binding(0, 0, samplers[0]),
+				avk::descriptor_binding(0, 1, samplers[1]),
+				avk::descriptor_binding(0, 2, samplers[2]),
+				avk::descriptor_binding(0, 3, samplers[3]),
+				avk::descriptor_binding(0, 4, samplers[4]),
+				avk::descriptor_binding(0, 5, samplers[5]),
+				avk::descriptor_binding(0, 6, samplers[6]),
+				avk::descriptor_binding(0, 7, samplers[7])
+			}, aResult);
+		};
+		static_assert(sNumberOfLatencyBindings <= sNumberOfSamplers);
+
+		// Fill the cache with the set, s.t. only cache hits are measured:
+		std::vector<avk::descriptor_set> result;
+		lookup(result);
+		if (1 != result.size() || !result.front().handle() || sNumberOfLatencyBindings != result.front().number_of_writes()) {
+			throw avk::runtime_error("descriptor_cache returned an unexpected result for the set of " + std::to_string(sNumberOfLatencyBindings) + " bindings");
+		}
+		const auto expected = result.front().handle();
+
+		const auto start = clock_type::now();
+		for (uint32_t i = 0; i < aLookups; ++i) {
+			lookup(result);
+		}
+		const auto nanoseconds = std::chrono::duration<double, std::nano>(clock_type::now() - start).count();
+		if (1 != result.size() || expected != result.front().handle()) {
+			throw avk::runtime_error("descriptor_cache did not return the cached set of " + std::to_string(sNumberOfLatencyBindings) + " bindings");
+		}
+		std::cout << "latency, " << sNumberOfLatencyBindings << " bindings: " << nanoseconds / aLookups << " ns per lookup (including the creation of the bindings)\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const std::string mode = argc > 1 ? argv[1] : "stress";
+	const auto hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+	const auto numThreads = argc > 2 ? static_cast<uint32_t>(std::max(1, std::atoi(argv[2]))) : hardwareThreads;
+
+	try {
+		benchmark_root root;
+		if ("stress" == mode) {
+			const auto iterations = argc > 3 ? static_cast<uint32_t>(std::max(1, std::atoi(argv[3]))) : 20000u;
+			return stress(root, numThreads, iterations) ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+		if ("scaling" == mode) {
+			const auto lookups = argc > 3 ? static_cast<uint32_t>(std::max(1, std::atoi(argv[3]))) : 200000u;
+			scaling(root, numThreads, lookups);
+			return EXIT_SUCCESS;
+		}
+		if ("latency" == mode) {
+			const auto lookups = argc > 3 ? static_cast<uint32_t>(std::max(1, std::atoi(argv[3]))) : 1000000u;
+			latency(root, lookups);
+			return EXIT_SUCCESS;
+		}
+		std::cerr << "Unknown mode '" << mode << "', expected 'stress', 'scaling', or 'latency'.\n";
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Benchmark failed: " << e.what() << std::endl;
+	}
+	return EXIT_FAILURE;
+}
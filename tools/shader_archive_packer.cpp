@@ -0,0 +1,129 @@
+// Packs SPIR-V shader binaries into one shader archive, which can be mounted
+// at runtime via avk::shader_archive::mount.
+//
+// Usage: avk_shader_archive_packer [-C <base-directory>] <output-file> <input>...
+//
+// Inputs can be files or directories. Directories are traversed recursively and
+// all *.spv files contained are added. Every shader is stored under its path
+// relative to the base directory (default: the current working directory), i.e.
+// the same path that is passed to avk::shader_info::describe at runtime.
+#include <avk/shader_archive_format.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct input_file
+	{
+		std::string mKey;
+		std::filesystem::path mPath;
+		uint64_t mPathHash;
+		std::vector<char> mCode;
+	};
+
+	std::vector<char> read_file(const std::filesystem::path& aPath)
+	{
+		std::ifstream is(aPath, std::ifstream::binary);
+		if (!is) {
+			throw std::runtime_error("Couldn't open '" + aPath.string() + "'");
+		}
+		std::vector<char> result{ std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+		if (0 != result.size() % sizeof(uint32_t) || result.size() < sizeof(uint32_t)) {
+			throw std::runtime_error("'" + aPath.string() + "' is not a SPIR-V binary: Its size is not a multiple of 4.");
+		}
+		uint32_t magic;
+		memcpy(&magic, result.data(), sizeof(magic));
+		if (0x07230203u != magic) {
+			throw std::runtime_error("'" + aPath.string() + "' is not a SPIR-V binary: Wrong magic number.");
+		}
+		return result;
+	}
+
+	void add_input(const std::filesystem::path& aBase, const std::filesystem::path& aPath, std::vector<input_file>& aInputs)
+	{
+		auto key = avk::shader_archive_normalize_path(std::filesystem::relative(aPath, aBase).generic_string());
+		auto hash = avk::shader_archive_path_hash(key);
+		aInputs.push_back(input_file{ std::move(key), aPath, hash, read_file(aPath) });
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::filesystem::path base = std::filesystem::current_path();
+	std::vector<std::string> args(argv + 1, argv + argc);
+	if (args.size() >= 2 && "-C" == args[0]) {
+		base = args[1];
+		args.erase(args.begin(), args.begin() + 2);
+	}
+	if (args.size() < 2) {
+		std::cerr << "Usage: avk_shader_archive_packer [-C <base-directory>] <output-file> <input>..." << std::endl;
+		return 1;
+	}
+
+	try {
+		std::vector<input_file> inputs;
+		for (size_t i = 1; i < args.size(); ++i) {
+			const std::filesystem::path input = args[i];
+			if (std::filesystem::is_directory(input)) {
+				for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+					if (entry.is_regular_file() && entry.path().extension() == ".spv") {
+						add_input(base, entry.path(), inputs);
+					}
+				}
+			}
+			else {
+				add_input(base, input, inputs);
+			}
+		}
+
+		// The index must be sorted by hash so that it can be binary-searched at runtime:
+		std::sort(inputs.begin(), inputs.end(), [](const input_file& a, const input_file& b) { return a.mPathHash < b.mPathHash; });
+		for (size_t i = 1; i < inputs.size(); ++i) {
+			if (inputs[i - 1].mPathHash == inputs[i].mPathHash) {
+				throw std::runtime_error(inputs[i - 1].mKey == inputs[i].mKey
+					? "'" + inputs[i].mKey + "' has been added twice."
+					: "Hash collision between '" + inputs[i - 1].mKey + "' and '" + inputs[i].mKey + "'.");
+			}
+		}
+
+		avk::shader_archive_header header{ avk::shader_archive_magic, avk::shader_archive_version, static_cast<uint32_t>(inputs.size()), 0u };
+		std::vector<avk::shader_archive_entry> entries;
+		uint64_t offset = sizeof(header) + inputs.size() * sizeof(avk::shader_archive_entry);
+		for (const auto& input : inputs) {
+			offset = (offset + avk::shader_archive_blob_alignment - 1) / avk::shader_archive_blob_alignment * avk::shader_archive_blob_alignment;
+			entries.push_back(avk::shader_archive_entry{ input.mPathHash, offset, input.mCode.size() });
+			offset += input.mCode.size();
+		}
+
+		std::ofstream os(args[0], std::ofstream::binary | std::ofstream::trunc);
+		if (!os) {
+			throw std::runtime_error("Couldn't open '" + args[0] + "' for writing.");
+		}
+		os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		os.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(avk::shader_archive_entry)));
+		for (size_t i = 0; i < inputs.size(); ++i) {
+			const auto padding = entries[i].mOffset - static_cast<uint64_t>(os.tellp());
+			for (uint64_t p = 0; p < padding; ++p) {
+				os.put('\0');
+			}
+			os.write(inputs[i].mCode.data(), static_cast<std::streamsize>(inputs[i].mCode.size()));
+			std::cout << "Packed '" << inputs[i].mKey << "' (" << inputs[i].mCode.size() << " bytes)" << std::endl;
+		}
+		if (!os) {
+			throw std::runtime_error("Couldn't write '" + args[0] + "'.");
+		}
+	}
+	catch (const std::exception& e) {
+		std::cerr << "ERROR: " << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,188 @@
+// Compares the submission of many small batches from multiple threads to one queue, either through an
+// avk::submission_service, or directly via avk::queue::submit_with_completion_token, guarded by a mutex.
+//
+// Usage: avk_submission_service_benchmark [<threads> [<batches-per-thread> [<command-buffers-per-batch>]]]
+//
+// For both variants, it reports the throughput, the time which the recording threads spend in the
+// submit call, and the latency from the submit call until the batch's completion has been detected.
+// Requires a device which supports the timelineSemaphore feature.
+#include <avk/avk.hpp>
+#include "benchmark_root.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if VK_HEADER_VERSION < 135
+#error "avk_submission_service_benchmark requires Vulkan headers with timeline semaphores."
+#endif
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	struct config
+	{
+		uint32_t mThreads = 8;
+		uint32_t mBatchesPerThread = 2000;
+		uint32_t mCommandBuffersPerBatch = 1;
+	};
+
+	struct result
+	{
+		double mSeconds = 0.0;
+		// Per batch, in microseconds:
+		std::vector<double> mSubmitCallTimes;
+		std::vector<double> mLatencies;
+		uint64_t mSubmitCalls = 0;
+	};
+
+	double micros_between(clock_type::time_point aFrom, clock_type::time_point aTo)
+	{
+		return std::chrono::duration<double, std::micro>(aTo - aFrom).count();
+	}
+
+	std::vector<avk::command_buffer> record_empty_command_buffers(avk::command_pool& aPool, uint32_t aCount)
+	{
+		auto cbs = aPool->alloc_command_buffers(aCount, vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+		for (auto& cb : cbs) {
+			cb->begin_recording();
+			cb->end_recording();
+		}
+		return cbs;
+	}
+
+	// Runs aSubmit(threadIndex, batchIndex, commandBuffers, onCompletion) for every batch on aConfig.mThreads threads.
+	// aSubmit must arrange for onCompletion to be invoked once the batch has completed.
+	template <typename F>
+	result run(benchmark_root& aRoot, const config& aConfig, F&& aSubmit)
+	{
+		const auto numBatches = static_cast<size_t>(aConfig.mThreads) * aConfig.mBatchesPerThread;
+		result res;
+		res.mSubmitCallTimes.resize(numBatches);
+		res.mLatencies.resize(numBatches);
+
+		// One pool per thread, which outlives all of the command buffers allocated from it:
+		std::vector<avk::command_pool> pools;
+		for (uint32_t t = 0; t < aConfig.mThreads; ++t) {
+			pools.push_back(aRoot.create_command_pool(aRoot.queue().family_index(), vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer));
+		}
+
+		std::atomic<size_t> numCompleted{ 0 };
+		const auto start = clock_type::now();
+		std::vector<std::thread> threads;
+		for (uint32_t t = 0; t < aConfig.mThreads; ++t) {
+			threads.emplace_back([&, t]() {
+				for (uint32_t b = 0; b < aConfig.mBatchesPerThread; ++b) {
+					const auto i = static_cast<size_t>(t) * aConfig.mBatchesPerThread + b;
+					auto cbs = record_empty_command_buffers(pools[t], aConfig.mCommandBuffersPerBatch);
+					const auto submitStart = clock_type::now();
+					aSubmit(std::move(cbs), [&res, &numCompleted, i, submitStart]() {
+						res.mLatencies[i] = micros_between(submitStart, clock_type::now());
+						numCompleted.fetch_add(1, std::memory_order_release);
+					});
+					res.mSubmitCallTimes[i] = micros_between(submitStart, clock_type::now());
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		while (numCompleted.load(std::memory_order_acquire) < numBatches) {
+			std::this_thread::yield();
+		}
+		res.mSeconds = std::chrono::duration<double>(clock_type::now() - start).count();
+		return res;
+	}
+
+	double percentile(std::vector<double> aValues, double aFraction)
+	{
+		const auto n = static_cast<size_t>(aFraction * static_cast<double>(aValues.size() - 1));
+		std::nth_element(std::begin(aValues), std::begin(aValues) + n, std::end(aValues));
+		return aValues[n];
+	}
+
+	void report(const std::string& aName, const result& aResult)
+	{
+		const auto numBatches = aResult.mLatencies.size();
+		const auto mean = [](const std::vector<double>& aValues) {
+			return std::accumulate(std::begin(aValues), std::end(aValues), 0.0) / static_cast<double>(aValues.size());
+		};
+		std::cout << aName << ":\n"
+			<< "  throughput:        " << static_cast<double>(numBatches) / aResult.mSeconds << " batches/s\n"
+			<< "  submit call [us]:  mean " << mean(aResult.mSubmitCallTimes) << ", p50 " << percentile(aResult.mSubmitCallTimes, 0.5) << ", p99 " << percentile(aResult.mSubmitCallTimes, 0.99) << "\n"
+			<< "  latency [us]:      mean " << mean(aResult.mLatencies) << ", p50 " << percentile(aResult.mLatencies, 0.5) << ", p99 " << percentile(aResult.mLatencies, 0.99) << "\n";
+		if (0 != aResult.mSubmitCalls) {
+			std::cout << "  vkQueueSubmit calls: " << aResult.mSubmitCalls << " (" << static_cast<double>(numBatches) / static_cast<double>(aResult.mSubmitCalls) << " batches per call)\n";
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	config cfg;
+	if (argc > 1) { cfg.mThreads = static_cast<uint32_t>(std::max(1, std::atoi(argv[1]))); }
+	if (argc > 2) { cfg.mBatchesPerThread = static_cast<uint32_t>(std::max(1, std::atoi(argv[2]))); }
+	if (argc > 3) { cfg.mCommandBuffersPerBatch = static_cast<uint32_t>(std::max(1, std::atoi(argv[3]))); }
+	std::cout << cfg.mThreads << " threads, " << cfg.mBatchesPerThread << " batches per thread, " << cfg.mCommandBuffersPerBatch << " command buffer(s) per batch\n";
+
+	try {
+		benchmark_root root;
+		auto& q = root.queue();
+		{
+			avk::completion_dispatcher dispatcher;
+			dispatcher.start_background_thread();
+
+			// Every submission locks the queue, which is what the submission_service avoids:
+			std::mutex queueMutex;
+			auto direct = run(root, cfg, [&](std::vector<avk::command_buffer> aCommandBuffers, avk::unique_function<void()> aOnCompletion) {
+				std::vector<avk::resource_reference<avk::command_buffer_t>> refs;
+				for (auto& cb : aCommandBuffers) {
+					refs.push_back(avk::referenced(cb));
+				}
+				avk::completion_token token;
+				{
+					std::scoped_lock guard(queueMutex);
+					token = q.submit_with_completion_token(std::move(refs), {}, vk::PipelineStageFlagBits::eAllCommands, &dispatcher);
+				}
+				dispatcher.on_completion(token, [lCommandBuffers = std::move(aCommandBuffers), lOnCompletion = std::move(aOnCompletion)]() mutable {
+					lOnCompletion();
+				});
+			});
+			direct.mSubmitCalls = static_cast<uint64_t>(direct.mLatencies.size());
+			report("locked queue::submit_with_completion_token", direct);
+
+			dispatcher.stop_background_thread();
+		}
+		{
+			avk::completion_dispatcher dispatcher;
+			dispatcher.start_background_thread();
+			avk::submission_service service{ q, dispatcher };
+			auto viaService = run(root, cfg, [&](std::vector<avk::command_buffer> aCommandBuffers, avk::unique_function<void()> aOnCompletion) {
+				avk::submission_service::batch b;
+				b.mCommandBuffers = std::move(aCommandBuffers);
+				b.mCompletionCallbacks.push_back(std::move(aOnCompletion));
+				service.submit(std::move(b));
+			});
+			viaService.mSubmitCalls = service.number_of_submit_calls();
+			report("submission_service", viaService);
+
+			service.flush();
+			q.handle().waitIdle(root.dispatch_loader_core());
+			dispatcher.stop_background_thread();
+			dispatcher.poll();
+		}
+	}
+	catch (const std::exception& e) {
+		std::cerr << "Benchmark failed: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}